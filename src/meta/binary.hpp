@@ -0,0 +1,436 @@
+#ifndef META_BINARY_HPP
+#define META_BINARY_HPP
+
+
+#include <vector>
+#include <cassert>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include "meta.hpp"
+#include "span.hpp"
+
+
+namespace meta {
+
+
+/**
+ * @brief Precompiled binary serialization plan for a reflected type.
+ *
+ * A plan is compiled once from the meta data of a type and is then executed
+ * as is for each and every object to serialize, with no further lookup.<br/>
+ * Objects of trivially copyable types are copied as a whole with a single
+ * memory copy. Otherwise, the non-static meta data of the type are visited in
+ * order and:
+ *
+ * * Fields of trivially copyable types with a known offset are copied straight
+ *   from the objects. Fields that are adjacent in memory are merged into a
+ *   single memory copy.
+ * * Other fields of trivially copyable types are copied from the value
+ *   returned by their getters.
+ * * Arrays of trivially copyable types are copied element by element.
+ * * Fields of other types are serialized recursively by means of their own
+ *   meta data, flattened into the same plan. They are accessed in place when
+ *   their offsets are known.
+ *
+ * A plan is invalid if the type or any of its fields isn't serializable, that
+ * is if they are pointers or they are neither trivially copyable nor
+ * reflected through meta data.<br/>
+ * Serialized objects of a given type have always the same size and the bytes
+ * are in the native representation of the platform. Streams are meant to be
+ * read back with the same binary that produced them, by means of a plan for
+ * the same type.
+ */
+class binary_plan {
+    static constexpr std::size_t scratch_size = 4u * sizeof(std::max_align_t);
+
+    struct step {
+        // empty for whole object copies
+        meta::data field;
+        // size in bytes of the encoded value, nested steps included
+        std::size_t size;
+        // number of elements for array fields, zero otherwise
+        std::size_t extent;
+        // number of nested steps that follow this one
+        std::size_t nested;
+        // position within the parent for fields accessed in place, npos otherwise
+        std::size_t offset;
+    };
+
+    static bool is_direct(const meta::data &field) noexcept {
+        return field.offset() != meta::data::npos && !field.is_const();
+    }
+
+    static bool is_leaf(const meta::type &type) noexcept {
+        return type.is_trivially_copyable() && !type.is_pointer() && type.size_of();
+    }
+
+    bool compile(const meta::type &type) {
+        const auto first = steps.size();
+        bool valid = type && !type.is_pointer();
+
+        if(valid && is_leaf(type)) {
+            steps.push_back({meta::data{}, type.size_of(), 0u, 0u, meta::data::npos});
+        } else if(valid) {
+            std::vector<step> direct{};
+
+            type.data([this, &valid, &direct](meta::data field) {
+                if(valid && !field.is_static()) {
+                    const auto field_type = field.type();
+                    const auto pos = steps.size();
+
+                    if(is_direct(field) && is_leaf(field_type)) {
+                        direct.push_back({field, field_type.size_of(), 0u, 0u, field.offset()});
+                    } else if(field_type.is_array()) {
+                        valid = field_type.extent() && is_leaf(field_type);
+                        steps.push_back({field, field_type.size_of(), field_type.extent(), 0u, meta::data::npos});
+                    } else if(is_leaf(field_type)) {
+                        steps.push_back({field, field_type.size_of(), 0u, 0u, meta::data::npos});
+                    } else {
+                        steps.push_back({field, 0u, 0u, 0u, is_direct(field) ? field.offset() : meta::data::npos});
+                        valid = !field_type.is_pointer() && field_type.is_class() && compile(field_type);
+                        steps[pos].nested = steps.size() - pos - 1u;
+
+                        for(auto next = pos + 1u; next < steps.size(); next += steps[next].nested + 1u) {
+                            steps[pos].size += steps[next].size;
+                        }
+                    }
+                }
+            });
+
+            // fields accessed in place come first, sorted by offset and merged when adjacent
+            std::sort(direct.begin(), direct.end(), [](const auto &lhs, const auto &rhs) {
+                return lhs.offset < rhs.offset;
+            });
+
+            std::vector<step> merged{};
+
+            for(auto &&curr: direct) {
+                if(!merged.empty() && merged.back().offset + merged.back().size == curr.offset) {
+                    merged.back().size += curr.size;
+                } else {
+                    merged.push_back(curr);
+                }
+            }
+
+            steps.insert(steps.begin() + first, merged.cbegin(), merged.cend());
+        }
+
+        // types that aren't trivially copyable are serialized only by means of their meta data
+        return valid && steps.size() != first;
+    }
+
+    bool write(const std::size_t first, const std::size_t last, handle instance, std::byte *out) const {
+        const auto *base = static_cast<const std::byte *>(instance.data());
+        bool done = true;
+
+        for(auto pos = first; done && pos < last; pos += steps[pos].nested + 1u) {
+            const auto &curr = steps[pos];
+
+            if(!curr.field) {
+                std::memcpy(out, base, curr.size);
+            } else if(curr.offset != meta::data::npos) {
+                if(curr.nested) {
+                    done = write(pos + 1u, pos + curr.nested + 1u, handle{curr.field.type(), const_cast<std::byte *>(base + curr.offset)}, out);
+                } else {
+                    std::memcpy(out, base + curr.offset, curr.size);
+                }
+            } else if(curr.extent) {
+                const auto size = curr.size / curr.extent;
+
+                for(std::size_t idx{}; done && idx < curr.extent; ++idx) {
+                    const any value = curr.field.get(instance, idx);
+
+                    if((done = value && value.data())) {
+                        std::memcpy(out + idx * size, value.data(), size);
+                    }
+                }
+            } else {
+                any value = curr.field.get(instance);
+
+                if((done = value && value.data())) {
+                    if(curr.nested) {
+                        done = write(pos + 1u, pos + curr.nested + 1u, value, out);
+                    } else {
+                        std::memcpy(out, value.data(), curr.size);
+                    }
+                }
+            }
+
+            out += curr.size;
+        }
+
+        return done;
+    }
+
+    bool assign(const step &curr, handle instance, const std::byte *in) const {
+        bool done = true;
+
+        if(const auto type = curr.field.type(); curr.extent) {
+            const auto size = curr.size / curr.extent;
+
+            for(std::size_t idx{}; done && idx < curr.extent; ++idx) {
+                any value = curr.field.get(instance, idx);
+
+                if((done = value && value.data())) {
+                    std::memcpy(value.data(), in + idx * size, size);
+                    done = curr.field.set(instance, idx, value);
+                }
+            }
+        } else if(alignas(std::max_align_t) std::byte local[scratch_size]; curr.size <= scratch_size && type.align_of() <= alignof(std::max_align_t)) {
+            // input bytes can be misaligned, setters are fed with a suitably aligned copy
+            std::memcpy(local, in, curr.size);
+            done = curr.field.set(instance, any{handle{type, local}});
+        } else {
+            any value = curr.field.get(instance);
+
+            if((done = value && value.data())) {
+                std::memcpy(value.data(), in, curr.size);
+                done = curr.field.set(instance, value);
+            }
+        }
+
+        return done;
+    }
+
+    bool read(const std::size_t first, const std::size_t last, handle instance, const std::byte *in) const {
+        bool done = true;
+
+        for(auto pos = first; done && pos < last; pos += steps[pos].nested + 1u) {
+            const auto &curr = steps[pos];
+
+            if(!curr.field) {
+                std::memcpy(instance.data(), in, curr.size);
+            } else if(curr.offset != meta::data::npos) {
+                auto *base = static_cast<std::byte *>(instance.data()) + curr.offset;
+
+                if(curr.nested) {
+                    done = read(pos + 1u, pos + curr.nested + 1u, handle{curr.field.type(), base}, in);
+                } else {
+                    std::memcpy(base, in, curr.size);
+                }
+            } else if(curr.field.is_const()) {
+                // read-only fields are part of the stream but cannot be restored
+            } else if(curr.nested) {
+                any value = curr.field.get(instance);
+
+                if((done = value && value.data())) {
+                    done = read(pos + 1u, pos + curr.nested + 1u, value, in) && curr.field.set(instance, value);
+                }
+            } else {
+                done = assign(curr, instance, in);
+            }
+
+            in += curr.size;
+        }
+
+        return done;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor, an invalid plan. */
+    binary_plan() noexcept
+        : owner{},
+          steps{},
+          encoded{}
+    {}
+
+    /**
+     * @brief Compiles a plan for a given meta type.
+     * @param type A valid meta type.
+     */
+    explicit binary_plan(const meta::type &type)
+        : owner{type},
+          steps{},
+          encoded{}
+    {
+        if(compile(type)) {
+            for(size_type pos{}; pos < steps.size(); pos += steps[pos].nested + 1u) {
+                encoded += steps[pos].size;
+            }
+        } else {
+            steps.clear();
+            owner = {};
+        }
+    }
+
+    /**
+     * @brief Returns the meta type for which a plan has been compiled.
+     * @return The meta type of the plan, if any.
+     */
+    meta::type type() const noexcept {
+        return owner;
+    }
+
+    /**
+     * @brief Returns the number of bytes required to serialize an object.
+     * @return The size in bytes of a serialized object.
+     */
+    size_type size() const noexcept {
+        return encoded;
+    }
+
+    /**
+     * @brief Serializes an object into a caller-supplied buffer.
+     *
+     * The buffer must be at least `size()` bytes long. Otherwise, serializing
+     * the object results in an undefined behavior.
+     *
+     * @param instance A handle to an object of the underlying type.
+     * @param out A pointer to the first byte of the output buffer.
+     * @return True in case of success, false otherwise.
+     */
+    bool serialize(handle instance, std::byte *out) const {
+        assert(*this);
+        return instance.type() == owner && write(0u, steps.size(), instance, out);
+    }
+
+    /**
+     * @brief Serializes an object at the end of a vector of bytes.
+     * @param instance A handle to an object of the underlying type.
+     * @param out The vector to which to append the serialized object.
+     * @return True in case of success, false otherwise.
+     */
+    bool serialize(handle instance, std::vector<std::byte> &out) const {
+        const auto pos = out.size();
+        out.resize(pos + encoded);
+        const bool done = serialize(instance, out.data() + pos);
+
+        if(!done) {
+            out.resize(pos);
+        }
+
+        return done;
+    }
+
+    /**
+     * @brief Serializes a range of objects at the end of a vector of bytes.
+     *
+     * Objects are written one after the other. The vector is resized only
+     * once for the whole range.
+     *
+     * @param range A meta span of objects of the underlying type.
+     * @param out The vector to which to append the serialized objects.
+     * @return True in case of success, false otherwise.
+     */
+    bool serialize(const any_span &range, std::vector<std::byte> &out) const {
+        assert(*this);
+        const auto pos = out.size();
+        bool done = range.empty() || range.type() == owner;
+
+        if(done) {
+            out.resize(pos + range.size() * encoded);
+
+            for(size_type idx{}; done && idx < range.size(); ++idx) {
+                done = write(0u, steps.size(), range[idx], out.data() + pos + idx * encoded);
+            }
+
+            if(!done) {
+                out.resize(pos);
+            }
+        }
+
+        return done;
+    }
+
+    /**
+     * @brief Deserializes an object into an existing instance.
+     *
+     * Objects of trivially copyable types are copied straight from the input
+     * buffer. Otherwise, fields are assigned through their setters. Values of
+     * read-only fields are skipped.<br/>
+     * The input buffer isn't copied as a whole and can be, for example, a
+     * memory mapped file.
+     *
+     * @param in A pointer to the first byte of the input buffer.
+     * @param length Size in bytes of the input buffer.
+     * @param instance A handle to an object of the underlying type.
+     * @return True in case of success, false otherwise.
+     */
+    bool deserialize(const std::byte *in, const size_type length, handle instance) const {
+        assert(*this);
+        return length >= encoded && instance.type() == owner && read(0u, steps.size(), instance, in);
+    }
+
+    /**
+     * @brief Deserializes a range of objects into existing instances.
+     *
+     * Objects are read one after the other from the input buffer.
+     *
+     * @param in A pointer to the first byte of the input buffer.
+     * @param length Size in bytes of the input buffer.
+     * @param range A meta span of objects of the underlying type.
+     * @return True in case of success, false otherwise.
+     */
+    bool deserialize(const std::byte *in, const size_type length, const any_span &range) const {
+        assert(*this);
+        bool done = range.empty() || (range.type() == owner && length / range.size() >= encoded);
+
+        for(size_type idx{}; done && idx < range.size(); ++idx) {
+            done = read(0u, steps.size(), range[idx], in + idx * encoded);
+        }
+
+        return done;
+    }
+
+    /**
+     * @brief Deserializes an object into an uninitialized storage.
+     *
+     * The object is created in place by means of the meta constructor that
+     * accepts no arguments and its fields are then read from the input
+     * buffer. The object is destroyed in case of errors.
+     *
+     * @param in A pointer to the first byte of the input buffer.
+     * @param length Size in bytes of the input buffer.
+     * @param storage Suitably sized and aligned storage for the object.
+     * @return True in case of success, false otherwise.
+     */
+    bool deserialize_at(const std::byte *in, const size_type length, void *storage) const {
+        assert(*this);
+        bool done = length >= encoded && owner.construct_at(storage);
+
+        if(done && !(done = read(0u, steps.size(), handle{owner, storage}, in))) {
+            owner.destroy_at(storage);
+        }
+
+        return done;
+    }
+
+    /**
+     * @brief Deserializes an object into a new meta any object.
+     *
+     * The object is created by means of the meta constructor that accepts no
+     * arguments and its fields are then read from the input buffer.
+     *
+     * @param in A pointer to the first byte of the input buffer.
+     * @param length Size in bytes of the input buffer.
+     * @return A meta any containing the new instance, if any.
+     */
+    any deserialize(const std::byte *in, const size_type length) const {
+        assert(*this);
+        any instance = length >= encoded ? owner.construct() : any{};
+        return (instance && read(0u, steps.size(), instance, in)) ? instance : any{};
+    }
+
+    /**
+     * @brief Returns false if a plan is invalid, true otherwise.
+     * @return False if the plan is invalid, true otherwise.
+     */
+    explicit operator bool() const noexcept {
+        return static_cast<bool>(owner);
+    }
+
+private:
+    meta::type owner;
+    std::vector<step> steps;
+    size_type encoded;
+};
+
+
+}
+
+
+#endif // META_BINARY_HPP
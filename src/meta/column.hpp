@@ -0,0 +1,389 @@
+#ifndef META_COLUMN_HPP
+#define META_COLUMN_HPP
+
+
+#include <new>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include "meta.hpp"
+#include "span.hpp"
+
+
+namespace meta {
+
+
+/**
+ * @brief Type-erased contiguous container for objects of a reflected type.
+ *
+ * A column stores instances of a single meta type in a contiguous, growable
+ * buffer, much like a vector does for a type known at compile-time. Objects
+ * are created by means of the registered meta constructors and copied, moved
+ * and destroyed by means of the operations of the underlying type.<br/>
+ * Unlike a vector of meta any objects, elements aren't allocated one by one
+ * and iterating them results in a linear walk through memory.
+ *
+ * Handles to elements are invalidated when the column grows.
+ */
+class column {
+    using byte_type = std::byte;
+
+    const internal::type_ops * ops() const noexcept {
+        return owner.node->ops;
+    }
+
+    byte_type * at(const std::size_t pos) const noexcept {
+        return instances + pos * owner.size_of();
+    }
+
+    template<typename Func>
+    struct rollback {
+        ~rollback() {
+            if(armed) {
+                func();
+            }
+        }
+
+        Func func;
+        bool armed;
+    };
+
+    template<typename Func>
+    static rollback<Func> on_failure(Func func, const bool armed = true) {
+        return {std::move(func), armed};
+    }
+
+    void relocate(byte_type *to) {
+        if(owner.is_trivially_copyable()) {
+            if(count) {
+                std::memcpy(to, instances, count * owner.size_of());
+            }
+        } else {
+            std::size_t pos{};
+
+            auto built = on_failure([this, to, &pos]() {
+                while(pos) {
+                    --pos;
+                    ops()->destroy_at(to + pos * owner.size_of());
+                }
+            });
+
+            for(; pos < count; ++pos) {
+                // move_at falls back to copies when moving can throw
+                if(ops()->move_at) {
+                    ops()->move_at(to + pos * owner.size_of(), at(pos));
+                } else {
+                    ops()->copy_at(to + pos * owner.size_of(), at(pos));
+                }
+            }
+
+            built.armed = false;
+        }
+    }
+
+    template<typename Func>
+    bool reallocate(const std::size_t cap, Func func) {
+        auto *mem = static_cast<byte_type *>(::operator new(cap * owner.size_of(), std::align_val_t{owner.align_of()}));
+        auto memory = on_failure([this, mem]() { ::operator delete(mem, std::align_val_t{owner.align_of()}); });
+
+        // the new element comes first, arguments may refer to the old ones
+        auto element = on_failure([this, mem]() { ops()->destroy_at(mem + count * owner.size_of()); }, false);
+        // armed only once the element exists, a throwing constructor leaves nothing to destroy
+        element.armed = func(mem + count * owner.size_of());
+        relocate(mem);
+
+        if(!owner.is_trivially_copyable()) {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                // relocated objects aren't destroyed from the user's point of view
+                ops()->destroy_at(at(pos));
+            }
+        }
+
+        if(instances) {
+            ::operator delete(instances, std::align_val_t{owner.align_of()});
+        }
+
+        const bool appended = std::exchange(element.armed, false);
+        memory.armed = false;
+        instances = mem;
+        reserved = cap;
+        count += appended;
+
+        return appended;
+    }
+
+    void release() {
+        clear();
+
+        if(instances) {
+            ::operator delete(instances, std::align_val_t{owner.align_of()});
+            instances = nullptr;
+            reserved = {};
+        }
+    }
+
+    template<typename Func>
+    handle append(Func func) {
+        bool appended{};
+
+        if(count == reserved) {
+            appended = reallocate(reserved ? 2u * reserved : 1u, std::move(func));
+        } else if((appended = func(at(count)))) {
+            ++count;
+        }
+
+        return appended ? handle{owner, at(count - 1u)} : handle{};
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an empty column for a given meta type.
+     *
+     * The meta type must have a non-null size and objects of the underlying
+     * type must be at least move or copy constructible.
+     *
+     * @param type A valid meta type.
+     */
+    explicit column(const meta::type &type) noexcept
+        : owner{type},
+          instances{nullptr},
+          reserved{},
+          count{}
+    {
+        assert(type && type.size_of() && (type.node->ops->move_at || type.node->ops->copy_at) && type.node->ops->destroy_at);
+    }
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     */
+    column(const column &other)
+        : column{other.owner}
+    {
+        assert(!other.count || ops()->copy_at);
+        reserve(other.count);
+
+        for(; count < other.count; ++count) {
+            ops()->copy_at(at(count), other.at(count));
+        }
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    column(column &&other) noexcept
+        : owner{other.owner},
+          instances{std::exchange(other.instances, nullptr)},
+          reserved{std::exchange(other.reserved, size_type{})},
+          count{std::exchange(other.count, size_type{})}
+    {}
+
+    /*! @brief Destroys all the elements and frees the memory. */
+    ~column() {
+        release();
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to assign.
+     * @return This column.
+     */
+    column & operator=(const column &other) {
+        return (*this = column{other});
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to assign.
+     * @return This column.
+     */
+    column & operator=(column &&other) noexcept {
+        if(this != &other) {
+            release();
+            owner = other.owner;
+            instances = std::exchange(other.instances, nullptr);
+            reserved = std::exchange(other.reserved, size_type{});
+            count = std::exchange(other.count, size_type{});
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the meta type of the elements of a column.
+     * @return The meta type of the elements of the column.
+     */
+    meta::type type() const noexcept {
+        return owner;
+    }
+
+    /**
+     * @brief Returns the number of elements in a column.
+     * @return Number of elements.
+     */
+    size_type size() const noexcept {
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of elements that a column has currently
+     * allocated space for.
+     * @return Capacity of the column.
+     */
+    size_type capacity() const noexcept {
+        return reserved;
+    }
+
+    /**
+     * @brief Checks whether a column is empty.
+     * @return True if the column is empty, false otherwise.
+     */
+    bool empty() const noexcept {
+        return !count;
+    }
+
+    /**
+     * @brief Increases the capacity of a column.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated and the elements are relocated. Otherwise this function does
+     * nothing.<br/>
+     * Elements are moved if their move constructor doesn't throw, copied
+     * otherwise. The column is left unchanged if an exception is thrown,
+     * unless the elements can only be moved.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        if(cap > reserved) {
+            reallocate(cap, [](void *) { return false; });
+        }
+    }
+
+    /**
+     * @brief Appends a new element at the end of a column, if possible.
+     *
+     * The meta constructor is selected as in the case of
+     * meta::type::construct_at. Therefore, only the meta constructors of the
+     * type are used and those of its base classes are never tried.
+     *
+     * @tparam Args Types of arguments to use to construct the element.
+     * @param args Parameters to use to construct the element.
+     * @return A handle to the new element, an empty handle in case no suitable
+     * meta constructor exists.
+     */
+    template<typename... Args>
+    handle emplace_back(Args &&... args) {
+        return append([this, &args...](void *storage) {
+            return owner.construct_at(storage, std::forward<Args>(args)...);
+        });
+    }
+
+    /**
+     * @brief Appends a copy of an object at the end of a column, if possible.
+     *
+     * The object must have exactly the type of the elements of the column.
+     *
+     * @param value A handle to the object to copy.
+     * @return A handle to the new element, an empty handle in case the object
+     * cannot be copied.
+     */
+    handle push_back(handle value) {
+        return append([this, &value](void *storage) {
+            const bool accepted = value.type() == owner && ops()->copy_at;
+
+            if(accepted) {
+                ops()->copy_at(storage, value.data());
+            }
+
+            return accepted;
+        });
+    }
+
+    /**
+     * @brief Removes the last element of a column.
+     *
+     * The meta destructor is invoked, if any, along with the actual destructor
+     * of the object.
+     *
+     * @warning
+     * Attempting to remove an element from an empty column results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the column is empty.
+     */
+    void pop_back() {
+        assert(count);
+        owner.destroy_at(at(--count));
+    }
+
+    /**
+     * @brief Removes all the elements from a column.
+     *
+     * The meta destructor is invoked for each element, if any, along with the
+     * actual destructor of the object. The capacity isn't affected.
+     */
+    void clear() {
+        while(count) {
+            pop_back();
+        }
+    }
+
+    /**
+     * @brief Direct access to the array of elements of a column.
+     * @return A pointer to the array of elements.
+     */
+    const void * data() const noexcept {
+        return instances;
+    }
+
+    /*! @copydoc data */
+    void * data() noexcept {
+        return instances;
+    }
+
+    /**
+     * @brief Returns a handle to the element at a given position.
+     *
+     * @warning
+     * Attempting to access an element out of bounds results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * of invalid positions.
+     *
+     * @param pos Position of the element to return.
+     * @return A handle to the requested element.
+     */
+    handle operator[](const size_type pos) const noexcept {
+        assert(pos < count);
+        return handle{owner, at(pos)};
+    }
+
+    /**
+     * @brief Returns a view over the elements of a column.
+     *
+     * The view is invalidated when the column grows.
+     *
+     * @return A meta span over the elements of the column.
+     */
+    any_span span() const noexcept {
+        return any_span{owner, instances, count};
+    }
+
+private:
+    meta::type owner;
+    byte_type *instances;
+    size_type reserved;
+    size_type count;
+};
+
+
+}
+
+
+#endif // META_COLUMN_HPP
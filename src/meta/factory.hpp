@@ -2,6 +2,7 @@
 #define META_FACTORY_HPP
 
 
+#include <new>
 #include <tuple>
 #include <array>
 #include <cassert>
@@ -9,6 +10,8 @@
 #include <utility>
 #include <functional>
 #include <type_traits>
+#include "hashed_string.hpp"
+#include "name_table.hpp"
 #include "policy.hpp"
 #include "meta.hpp"
 
@@ -40,6 +43,10 @@ struct function_helper<Ret(Args...)> {
     static auto arg(typename internal::func_node::size_type index) noexcept {
         return std::array<type_node *, sizeof...(Args)>{{type_info<Args>::resolve()...}}[index];
     }
+
+    static auto signature() noexcept {
+        return internal::signature<Args...>();
+    }
 };
 
 
@@ -71,38 +78,127 @@ template<typename Candidate>
 using function_helper_t = decltype(to_function_helper(std::declval<Candidate>()));
 
 
+template<typename Args, typename Policy = as_is_t, std::size_t... Indexes>
+auto arguments(any *args, [[maybe_unused]] std::size_t &conversions, std::index_sequence<Indexes...>) {
+    return std::make_tuple([&conversions]([[maybe_unused]] meta::any *any, auto *instance) {
+        using arg_type = std::remove_reference_t<decltype(*instance)>;
+
+        if constexpr(!std::is_same_v<Policy, as_strict_t>) {
+            // failed attempts aren't conversions, they only reject the candidate
+            if(!instance && any->convert<arg_type>()) {
+                ++conversions;
+                instance = any->try_cast<arg_type>();
+            }
+        }
+
+        return instance;
+    }(args+Indexes, (args+Indexes)->try_cast<std::tuple_element_t<Indexes, Args>>())...);
+}
+
+
+template<typename Args, typename Policy = as_is_t, std::size_t... Indexes>
+auto arguments(any *args, std::index_sequence<Indexes...> seq) {
+    std::size_t conversions{};
+    return arguments<Args, Policy>(args, conversions, seq);
+}
+
+
+template<typename Type, typename Policy>
+bool convert([[maybe_unused]] const data_node &node, [[maybe_unused]] any &value) {
+    if constexpr(std::is_same_v<Policy, as_strict_t>) {
+        // exact types and base classes only, they are taken care of by the caller
+        return false;
+    } else {
+        const bool converted = value.convert<Type>();
+        count_conversions(node, converted);
+        return converted;
+    }
+}
+
+
+template<typename Type, typename... Args, std::size_t... Indexes>
+any construct(any * const args, std::index_sequence<Indexes...> seq) {
+    [[maybe_unused]] const auto direct = arguments<std::tuple<Args...>>(args, seq);
+    return (std::get<Indexes>(direct) && ...) ? any{Type{*std::get<Indexes>(direct)...}} : any{};
+}
+
+
 template<typename Type, typename... Args, std::size_t... Indexes>
-any construct(any * const args, std::index_sequence<Indexes...>) {
-    [[maybe_unused]] auto direct = std::make_tuple((args+Indexes)->try_cast<Args>()...);
-    any any{};
+bool construct_at(void *storage, any * const args, std::index_sequence<Indexes...> seq) {
+    [[maybe_unused]] const auto direct = arguments<std::tuple<Args...>>(args, seq);
+    const bool accepted = (std::get<Indexes>(direct) && ...);
 
-    if(((std::get<Indexes>(direct) || (args+Indexes)->convert<Args>()) && ...)) {
-        any = Type{(std::get<Indexes>(direct) ? *std::get<Indexes>(direct) : (args+Indexes)->cast<Args>())...};
+    if(accepted) {
+        new (storage) Type{*std::get<Indexes>(direct)...};
     }
 
-    return any;
+    return accepted;
 }
 
 
-template<bool Const, typename Type, auto Data>
-bool setter([[maybe_unused]] handle handle, [[maybe_unused]] any index, [[maybe_unused]] any value) {
+template<typename Type, auto Candidate, typename Policy, std::size_t... Indexes>
+bool construct_at(void *storage, any * const args, std::index_sequence<Indexes...> seq) {
+    using helper_type = function_helper_t<decltype(Candidate)>;
+    [[maybe_unused]] const auto direct = arguments<typename helper_type::args_type, Policy>(args, seq);
+    const bool accepted = (std::get<Indexes>(direct) && ...);
+
+    if(accepted) {
+        new (storage) Type{std::invoke(Candidate, *std::get<Indexes>(direct)...)};
+    }
+
+    return accepted;
+}
+
+
+template<typename Type>
+union offset_storage {
+    offset_storage() noexcept: byte{} {}
+    ~offset_storage() {}
+
+    unsigned char byte;
+    Type instance;
+};
+
+
+template<typename Type, typename Policy, typename Member, typename Class>
+std::size_t offset(Member Class:: *member) noexcept {
+    if constexpr(std::is_same_v<Policy, as_is_t> && std::is_standard_layout_v<Type>) {
+        // no object is ever constructed, only the address of the member is taken
+        offset_storage<Type> storage{};
+        const auto *instance = std::addressof(storage.instance);
+        return static_cast<std::size_t>(reinterpret_cast<const unsigned char *>(std::addressof(instance->*member)) - reinterpret_cast<const unsigned char *>(instance));
+    } else {
+        return meta::data::npos;
+    }
+}
+
+
+template<auto... Candidate>
+inline constexpr std::tuple<decltype(Candidate)...> targets{Candidate...};
+
+
+template<bool Const, typename Type, typename Target, std::size_t Index, typename Policy>
+bool setter([[maybe_unused]] const data_node &node, [[maybe_unused]] handle handle, [[maybe_unused]] any index, [[maybe_unused]] any value) {
     bool accepted = false;
 
     if constexpr(!Const) {
-        if constexpr(std::is_function_v<std::remove_pointer_t<decltype(Data)>> || std::is_member_function_pointer_v<decltype(Data)>) {
-            using helper_type = function_helper_t<decltype(Data)>;
-            using data_type = std::tuple_element_t<!std::is_member_function_pointer_v<decltype(Data)>, typename helper_type::args_type>;
-            static_assert(std::is_invocable_v<decltype(Data), Type &, data_type>);
+        using candidate_type = std::tuple_element_t<Index, Target>;
+        const auto &candidate = std::get<Index>(*static_cast<const Target *>(node.target));
+
+        if constexpr(std::is_function_v<std::remove_pointer_t<candidate_type>> || std::is_member_function_pointer_v<candidate_type>) {
+            using helper_type = function_helper_t<candidate_type>;
+            using data_type = std::tuple_element_t<!std::is_member_function_pointer_v<candidate_type>, typename helper_type::args_type>;
+            static_assert(std::is_invocable_v<candidate_type, Type &, data_type>);
             auto *clazz = any{handle}.try_cast<Type>();
             auto *direct = value.try_cast<data_type>();
 
-            if(clazz && (direct || value.convert<data_type>())) {
-                std::invoke(Data, *clazz, direct ? *direct : value.cast<data_type>());
+            if(clazz && (direct || convert<data_type, Policy>(node, value))) {
+                std::invoke(candidate, *clazz, direct ? *direct : value.cast<data_type>());
                 accepted = true;
             }
-        } else if constexpr(std::is_member_object_pointer_v<decltype(Data)>) {
-            using data_type = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<Type>().*Data)>>;
-            static_assert(std::is_invocable_v<decltype(Data), Type *>);
+        } else if constexpr(std::is_member_object_pointer_v<candidate_type>) {
+            using data_type = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<Type>().*candidate)>>;
+            static_assert(std::is_invocable_v<candidate_type, Type *>);
             auto *clazz = any{handle}.try_cast<Type>();
 
             if constexpr(std::is_array_v<data_type>) {
@@ -110,36 +206,36 @@ bool setter([[maybe_unused]] handle handle, [[maybe_unused]] any index, [[maybe_
                 auto *direct = value.try_cast<underlying_type>();
                 auto *idx = index.try_cast<std::size_t>();
 
-                if(clazz && idx && (direct || value.convert<underlying_type>())) {
-                    std::invoke(Data, clazz)[*idx] = direct ? *direct : value.cast<underlying_type>();
+                if(clazz && idx && (direct || convert<underlying_type, Policy>(node, value))) {
+                    std::invoke(candidate, clazz)[*idx] = direct ? *direct : value.cast<underlying_type>();
                     accepted = true;
                 }
             } else {
                 auto *direct = value.try_cast<data_type>();
 
-                if(clazz && (direct || value.convert<data_type>())) {
-                    std::invoke(Data, clazz) = (direct ? *direct : value.cast<data_type>());
+                if(clazz && (direct || convert<data_type, Policy>(node, value))) {
+                    std::invoke(candidate, clazz) = (direct ? *direct : value.cast<data_type>());
                     accepted = true;
                 }
             }
         } else {
-            static_assert(std::is_pointer_v<decltype(Data)>);
-            using data_type = std::remove_cv_t<std::remove_reference_t<decltype(*Data)>>;
+            static_assert(std::is_pointer_v<candidate_type>);
+            using data_type = std::remove_cv_t<std::remove_reference_t<decltype(*candidate)>>;
 
             if constexpr(std::is_array_v<data_type>) {
                 using underlying_type = std::remove_extent_t<data_type>;
                 auto *direct = value.try_cast<underlying_type>();
                 auto *idx = index.try_cast<std::size_t>();
 
-                if(idx && (direct || value.convert<underlying_type>())) {
-                    (*Data)[*idx] = (direct ? *direct : value.cast<underlying_type>());
+                if(idx && (direct || convert<underlying_type, Policy>(node, value))) {
+                    (*candidate)[*idx] = (direct ? *direct : value.cast<underlying_type>());
                     accepted = true;
                 }
             } else {
                 auto *direct = value.try_cast<data_type>();
 
-                if(direct || value.convert<data_type>()) {
-                    *Data = (direct ? *direct : value.cast<data_type>());
+                if(direct || convert<data_type, Policy>(node, value)) {
+                    *candidate = (direct ? *direct : value.cast<data_type>());
                     accepted = true;
                 }
             }
@@ -150,74 +246,71 @@ bool setter([[maybe_unused]] handle handle, [[maybe_unused]] any index, [[maybe_
 }
 
 
-template<typename Type, auto Data, typename Policy>
-any getter([[maybe_unused]] handle handle, [[maybe_unused]] any index) {
+template<typename Type, typename Target, std::size_t Index, typename Policy>
+any getter([[maybe_unused]] const data_node &node, [[maybe_unused]] handle handle, [[maybe_unused]] any index) {
+    using candidate_type = std::tuple_element_t<Index, Target>;
+    const auto &candidate = std::get<Index>(*static_cast<const Target *>(node.target));
+
     auto dispatch = [](auto &&value) {
         if constexpr(std::is_same_v<Policy, as_void_t>) {
             return any{std::in_place_type<void>};
         } else if constexpr(std::is_same_v<Policy, as_alias_t>) {
             return any{std::ref(std::forward<decltype(value)>(value))};
         } else {
-            static_assert(std::is_same_v<Policy, as_is_t>);
+            static_assert(std::is_same_v<Policy, as_is_t> || std::is_same_v<Policy, as_strict_t>);
             return any{std::forward<decltype(value)>(value)};
         }
     };
 
-    if constexpr(std::is_function_v<std::remove_pointer_t<decltype(Data)>> || std::is_member_function_pointer_v<decltype(Data)>) {
-        static_assert(std::is_invocable_v<decltype(Data), Type &>);
+    if constexpr(std::is_same_v<Type, candidate_type>) {
+        return any{candidate};
+    } else if constexpr(std::is_function_v<std::remove_pointer_t<candidate_type>> || std::is_member_function_pointer_v<candidate_type>) {
+        static_assert(std::is_invocable_v<candidate_type, Type &>);
         auto *clazz = any{handle}.try_cast<Type>();
-        return clazz ? dispatch(std::invoke(Data, *clazz)) : any{};
-    } else if constexpr(std::is_member_object_pointer_v<decltype(Data)>) {
-        using data_type = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<Type>().*Data)>>;
-        static_assert(std::is_invocable_v<decltype(Data), Type *>);
+        return clazz ? dispatch(std::invoke(candidate, *clazz)) : any{};
+    } else if constexpr(std::is_member_object_pointer_v<candidate_type>) {
+        using data_type = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<Type>().*candidate)>>;
+        static_assert(std::is_invocable_v<candidate_type, Type *>);
         auto *clazz = any{handle}.try_cast<Type>();
 
         if constexpr(std::is_array_v<data_type>) {
             auto *idx = index.try_cast<std::size_t>();
-            return (clazz && idx) ? dispatch(std::invoke(Data, clazz)[*idx]) : any{};
+            return (clazz && idx) ? dispatch(std::invoke(candidate, clazz)[*idx]) : any{};
         } else {
-            return clazz ? dispatch(std::invoke(Data, clazz)) : any{};
+            return clazz ? dispatch(std::invoke(candidate, clazz)) : any{};
         }
     } else {
-        static_assert(std::is_pointer_v<std::decay_t<decltype(Data)>>);
+        static_assert(std::is_pointer_v<candidate_type>);
 
-        if constexpr(std::is_array_v<std::remove_pointer_t<decltype(Data)>>) {
+        if constexpr(std::is_array_v<std::remove_pointer_t<candidate_type>>) {
             auto *idx = index.try_cast<std::size_t>();
-            return idx ? dispatch((*Data)[*idx]) : any{};
+            return idx ? dispatch((*candidate)[*idx]) : any{};
         } else {
-            return dispatch(*Data);
+            return dispatch(*candidate);
         }
     }
 }
 
 
-template<typename Type, auto Candidate, typename Policy, std::size_t... Indexes>
-any invoke([[maybe_unused]] handle handle, any *args, std::index_sequence<Indexes...>) {
-    using helper_type = function_helper_t<decltype(Candidate)>;
+template<typename Type, typename Candidate, typename Policy, std::size_t... Indexes>
+any invoke(const Candidate &candidate, [[maybe_unused]] handle handle, any *args, [[maybe_unused]] std::size_t &conversions, std::index_sequence<Indexes...>) {
+    using helper_type = function_helper_t<Candidate>;
 
-    auto dispatch = [](auto *... args) {
+    auto dispatch = [&candidate](auto *... args) {
         if constexpr(std::is_void_v<typename helper_type::return_type> || std::is_same_v<Policy, as_void_t>) {
-            std::invoke(Candidate, *args...);
+            std::invoke(candidate, *args...);
             return any{std::in_place_type<void>};
         } else if constexpr(std::is_same_v<Policy, as_alias_t>) {
-            return any{std::ref(std::invoke(Candidate, *args...))};
+            return any{std::ref(std::invoke(candidate, *args...))};
         } else {
-            static_assert(std::is_same_v<Policy, as_is_t>);
-            return any{std::invoke(Candidate, *args...)};
+            static_assert(std::is_same_v<Policy, as_is_t> || std::is_same_v<Policy, as_strict_t>);
+            return any{std::invoke(candidate, *args...)};
         }
     };
 
-    [[maybe_unused]] const auto direct = std::make_tuple([](meta::any *any, auto *instance) {
-        using arg_type = std::remove_reference_t<decltype(*instance)>;
+    [[maybe_unused]] const auto direct = arguments<typename helper_type::args_type, Policy>(args, conversions, std::index_sequence<Indexes...>{});
 
-        if(!instance && any->convert<arg_type>()) {
-            instance = any->try_cast<arg_type>();
-        }
-
-        return instance;
-    }(args+Indexes, (args+Indexes)->try_cast<std::tuple_element_t<Indexes, typename helper_type::args_type>>())...);
-
-    if constexpr(std::is_function_v<std::remove_pointer_t<decltype(Candidate)>>) {
+    if constexpr(std::is_function_v<std::remove_pointer_t<Candidate>>) {
         return (std::get<Indexes>(direct) && ...) ? dispatch(std::get<Indexes>(direct)...) : any{};
     } else {
         auto *clazz = any{handle}.try_cast<Type>();
@@ -226,6 +319,16 @@ any invoke([[maybe_unused]] handle handle, any *args, std::index_sequence<Indexe
 }
 
 
+template<typename Type, typename Candidate, typename Policy>
+any invoke(const func_node &node, handle handle, any *args) {
+    const auto &candidate = std::get<0>(*static_cast<const std::tuple<Candidate> *>(node.target));
+    std::size_t conversions{};
+    auto any = invoke<Type, Candidate, Policy>(candidate, handle, args, conversions, std::make_index_sequence<function_helper_t<Candidate>::size>{});
+    count_conversions(node, conversions);
+    return any;
+}
+
+
 }
 
 
@@ -252,10 +355,64 @@ class factory {
         return node && (node->identifier == identifier || duplicate(identifier, node->next));
     }
 
+    bool ambiguous(const internal::func_node *candidate, const internal::func_node *node) noexcept {
+        bool same = node->size == candidate->size;
+
+        for(internal::func_node::size_type pos{}; same && pos < node->size; ++pos) {
+            same = (node->arg(pos) == candidate->arg(pos));
+        }
+
+        return same;
+    }
+
     bool duplicate(const any &key, const internal::prop_node *node) noexcept {
         return node && (node->key() == key || duplicate(key, node->next));
     }
 
+    bool record(const void *scope, const internal::named_identifier &identifier, const bool shared = false) {
+        auto *names = internal::type_info<>::names;
+        return !names || names->insert(scope, identifier, shared);
+    }
+
+    // not templates on purpose, they are shared by all the members of a type
+    void link(internal::data_node *node, const internal::named_identifier &identifier) {
+        auto * const type = internal::type_info<Type>::resolve();
+        node->identifier = identifier.value;
+        node->next = type->data;
+        [[maybe_unused]] const bool unique = record(name_table::data_scope(type), identifier);
+        // an attached name table spares the linear search
+        assert(unique && (internal::type_info<>::names || !duplicate(node->identifier, node->next)));
+        type->data = node;
+    }
+
+    void link(internal::func_node *node, const internal::named_identifier &identifier) {
+        auto * const type = internal::type_info<Type>::resolve();
+        node->identifier = identifier.value;
+        [[maybe_unused]] const bool unique = record(name_table::func_scope(type), identifier, true);
+        assert(unique);
+
+        // overloads are kept contiguous and in order of registration
+        auto **curr = &type->func;
+
+        while(*curr && (*curr)->identifier != node->identifier) {
+            curr = &(*curr)->next;
+        }
+
+        if(*curr) {
+            while(*curr && (*curr)->identifier == node->identifier) {
+                // overloads are contiguous, there is no need to look elsewhere for ambiguities
+                assert(!ambiguous(node, *curr));
+                curr = &(*curr)->next;
+            }
+        } else {
+            curr = &type->func;
+        }
+
+        node->next = *curr;
+        *curr = node;
+        ++internal::type_info<>::generation;
+    }
+
     template<typename>
     internal::prop_node * properties() {
         return nullptr;
@@ -333,13 +490,15 @@ public:
      * @return A meta factory for the parent type.
      */
     template<typename... Property>
-    factory type(const std::size_t identifier, Property &&... property) noexcept {
+    factory type(const internal::named_identifier identifier, Property &&... property) noexcept {
         assert(!internal::type_info<Type>::type);
         auto *node = internal::type_info<Type>::resolve();
-        node->identifier = identifier;
+        node->identifier = identifier.value;
         node->next = internal::type_info<>::type;
         node->prop = properties<Type>(std::forward<Property>(property)...);
-        assert(!duplicate(node->identifier, node->next));
+        [[maybe_unused]] const bool unique = record(name_table::types_scope(), identifier);
+        // an attached name table spares the linear search
+        assert(unique && (internal::type_info<>::names || !duplicate(node->identifier, node->next)));
         internal::type_info<Type>::type = node;
         internal::type_info<>::type = node;
 
@@ -376,6 +535,7 @@ public:
         assert((!internal::type_info<Type>::template base<Base>));
         internal::type_info<Type>::template base<Base> = &node;
         type->base = &node;
+        ++internal::type_info<>::generation;
 
         return *this;
     }
@@ -411,6 +571,7 @@ public:
         assert((!internal::type_info<Type>::template conv<To>));
         internal::type_info<Type>::template conv<To> = &node;
         type->conv = &node;
+        ++internal::type_info<>::generation;
 
         return *this;
     }
@@ -449,6 +610,7 @@ public:
         assert((!internal::type_info<Type>::template conv<conv_type>));
         internal::type_info<Type>::template conv<conv_type> = &node;
         type->conv = &node;
+        ++internal::type_info<>::generation;
 
         return *this;
     }
@@ -480,9 +642,15 @@ public:
             nullptr,
             nullptr,
             helper_type::size,
+            helper_type::signature(),
+            std::is_same_v<Policy, as_strict_t>,
             &helper_type::arg,
             [](any * const any) {
-                return internal::invoke<Type, Func, Policy>({}, any, std::make_index_sequence<helper_type::size>{});
+                std::size_t conversions{};
+                return internal::invoke<Type, decltype(Func), Policy>(Func, {}, any, conversions, std::make_index_sequence<helper_type::size>{});
+            },
+            [](void *storage, any * const any) {
+                return internal::construct_at<Type, Func, Policy>(storage, any, std::make_index_sequence<helper_type::size>{});
             },
             []() noexcept -> meta::ctor {
                 return &node;
@@ -494,6 +662,7 @@ public:
         assert((!internal::type_info<Type>::template ctor<typename helper_type::args_type>));
         internal::type_info<Type>::template ctor<typename helper_type::args_type> = &node;
         type->ctor = &node;
+        ++internal::type_info<>::generation;
 
         return *this;
     }
@@ -503,7 +672,9 @@ public:
      *
      * A meta constructor is uniquely identified by the types of its arguments
      * and is such that there exists an actual constructor of the underlying
-     * type that can be invoked with parameters whose types are those given.
+     * type that can be invoked with parameters whose types are those given.<br/>
+     * Policies don't apply to these constructors. Arguments are always cast or
+     * converted as in the case of the _as-is_ policy.
      *
      * @tparam Args Types of arguments to use to construct an instance.
      * @tparam Property Types of properties to assign to the meta data.
@@ -521,10 +692,15 @@ public:
             nullptr,
             nullptr,
             helper_type::size,
+            helper_type::signature(),
+            false,
             &helper_type::arg,
             [](any * const any) {
                 return internal::construct<Type, std::remove_cv_t<std::remove_reference_t<Args>>...>(any, std::make_index_sequence<helper_type::size>{});
             },
+            [](void *storage, any * const any) {
+                return internal::construct_at<Type, std::remove_cv_t<std::remove_reference_t<Args>>...>(storage, any, std::make_index_sequence<helper_type::size>{});
+            },
             []() noexcept -> meta::ctor {
                 return &node;
             }
@@ -535,6 +711,7 @@ public:
         assert((!internal::type_info<Type>::template ctor<typename helper_type::args_type>));
         internal::type_info<Type>::template ctor<typename helper_type::args_type> = &node;
         type->ctor = &node;
+        ++internal::type_info<>::generation;
 
         return *this;
     }
@@ -564,7 +741,7 @@ public:
             &internal::type_info<Type>::template dtor<Func>,
             type,
             [](handle handle) {
-                const auto valid = (handle.type() == internal::type_info<Type>::resolve()->clazz());
+                const auto valid = (handle.type() == internal::type_info<Type>::resolve()->ops->clazz());
 
                 if(valid) {
                     std::invoke(Func, *any{handle}.try_cast<Type>());
@@ -601,7 +778,7 @@ public:
      * @return A meta factory for the parent type.
      */
     template<auto Data, typename Policy = as_is_t, typename... Property>
-    factory data(const std::size_t identifier, Property &&... property) noexcept {
+    factory data(const internal::named_identifier identifier, Property &&... property) noexcept {
         auto * const type = internal::type_info<Type>::resolve();
         internal::data_node *curr = nullptr;
 
@@ -617,8 +794,10 @@ public:
                 true,
                 true,
                 &internal::type_info<Type>::resolve,
-                [](handle, any, any) { return false; },
-                [](handle, any) -> any { return Data; },
+                meta::data::npos,
+                &internal::targets<Data>,
+                &internal::setter<true, Type, std::tuple<Type>, 0u, Policy>,
+                &internal::getter<Type, std::tuple<Type>, 0u, Policy>,
                 []() noexcept -> meta::data {
                     return &node;
                 }
@@ -638,8 +817,10 @@ public:
                 std::is_const_v<data_type>,
                 !std::is_member_object_pointer_v<decltype(Data)>,
                 &internal::type_info<data_type>::resolve,
-                &internal::setter<std::is_const_v<data_type>, Type, Data>,
-                &internal::getter<Type, Data, Policy>,
+                internal::offset<Type, Policy>(Data),
+                &internal::targets<Data>,
+                &internal::setter<std::is_const_v<data_type>, Type, std::tuple<decltype(Data)>, 0u, Policy>,
+                &internal::getter<Type, std::tuple<decltype(Data)>, 0u, Policy>,
                 []() noexcept -> meta::data {
                     return &node;
                 }
@@ -660,8 +841,10 @@ public:
                 std::is_const_v<data_type>,
                 !std::is_member_object_pointer_v<decltype(Data)>,
                 &internal::type_info<data_type>::resolve,
-                &internal::setter<std::is_const_v<data_type>, Type, Data>,
-                &internal::getter<Type, Data, Policy>,
+                meta::data::npos,
+                &internal::targets<Data>,
+                &internal::setter<std::is_const_v<data_type>, Type, std::tuple<decltype(Data)>, 0u, Policy>,
+                &internal::getter<Type, std::tuple<decltype(Data)>, 0u, Policy>,
                 []() noexcept -> meta::data {
                     return &node;
                 }
@@ -671,12 +854,9 @@ public:
             curr = &node;
         }
 
-        curr->identifier = identifier;
-        curr->next = type->data;
-        assert(!duplicate(curr->identifier, curr->next));
         assert((!internal::type_info<Type>::template data<Data>));
         internal::type_info<Type>::template data<Data> = curr;
-        type->data = curr;
+        link(curr, identifier);
 
         return *this;
     }
@@ -704,8 +884,9 @@ public:
      * @return A meta factory for the parent type.
      */
     template<auto Setter, auto Getter, typename Policy = as_is_t, typename... Property>
-    factory data(const std::size_t identifier, Property &&... property) noexcept {
+    factory data(const internal::named_identifier identifier, Property &&... property) noexcept {
         using owner_type = std::tuple<std::integral_constant<decltype(Setter), Setter>, std::integral_constant<decltype(Getter), Getter>>;
+        using target_type = std::tuple<decltype(Setter), decltype(Getter)>;
         using underlying_type = std::invoke_result_t<decltype(Getter), Type &>;
         static_assert(std::is_invocable_v<decltype(Setter), Type &, underlying_type>);
         auto * const type = internal::type_info<Type>::resolve();
@@ -719,20 +900,19 @@ public:
             false,
             false,
             &internal::type_info<underlying_type>::resolve,
-            &internal::setter<false, Type, Setter>,
-            &internal::getter<Type, Getter, Policy>,
+            meta::data::npos,
+            &internal::targets<Setter, Getter>,
+            &internal::setter<false, Type, target_type, 0u, Policy>,
+            &internal::getter<Type, target_type, 1u, Policy>,
             []() noexcept -> meta::data {
                 return &node;
             }
         };
 
-        node.identifier = identifier;
-        node.next = type->data;
         node.prop = properties<owner_type>(std::forward<Property>(property)...);
-        assert(!duplicate(node.identifier, node.next));
         assert((!internal::type_info<Type>::template data<Setter, Getter>));
         internal::type_info<Type>::template data<Setter, Getter> = &node;
-        type->data = &node;
+        link(&node, identifier);
 
         return *this;
     }
@@ -743,17 +923,19 @@ public:
      * Both member functions and free functions can be assigned to a meta
      * type.<br/>
      * From a client's point of view, all the functions associated with the
-     * reflected object will appear as if they were part of the type itself.
+     * reflected object will appear as if they were part of the type itself.<br/>
+     * Functions can be overloaded by assigning them the same identifier, as
+     * long as the types of their arguments differ.
      *
      * @tparam Candidate The actual function to attach to the meta type.
      * @tparam Policy Optional policy (no policy set by default).
      * @tparam Property Types of properties to assign to the meta function.
-     * @param identifier Unique identifier.
+     * @param identifier Unique identifier, shared among overloads.
      * @param property Properties to assign to the meta function.
      * @return A meta factory for the parent type.
      */
     template<auto Candidate, typename Policy = as_is_t, typename... Property>
-    factory func(const std::size_t identifier, Property &&... property) noexcept {
+    factory func(const internal::named_identifier identifier, Property &&... property) noexcept {
         using owner_type = std::integral_constant<decltype(Candidate), Candidate>;
         using helper_type = internal::function_helper_t<decltype(Candidate)>;
         auto * const type = internal::type_info<Type>::resolve();
@@ -765,25 +947,23 @@ public:
             nullptr,
             nullptr,
             helper_type::size,
+            helper_type::signature(),
+            std::is_same_v<Policy, as_strict_t>,
             helper_type::is_const,
             !std::is_member_function_pointer_v<decltype(Candidate)>,
             &internal::type_info<std::conditional_t<std::is_same_v<Policy, as_void_t>, void, typename helper_type::return_type>>::resolve,
             &helper_type::arg,
-            [](handle handle, any *any) {
-                return internal::invoke<Type, Candidate, Policy>(handle, any, std::make_index_sequence<helper_type::size>{});
-            },
+            &internal::targets<Candidate>,
+            &internal::invoke<Type, decltype(Candidate), Policy>,
             []() noexcept -> meta::func {
                 return &node;
             }
         };
 
-        node.identifier = identifier;
-        node.next = type->func;
         node.prop = properties<owner_type>(std::forward<Property>(property)...);
-        assert(!duplicate(node.identifier, node.next));
         assert((!internal::type_info<Type>::template func<Candidate>));
         internal::type_info<Type>::template func<Candidate> = &node;
-        type->func = &node;
+        link(&node, identifier);
 
         return *this;
     }
@@ -815,6 +995,19 @@ public:
                 }
             }
 
+            if(auto *names = internal::type_info<>::names; names) {
+                auto * const node = internal::type_info<Type>::type;
+                names->erase(name_table::types_scope(), node->identifier);
+
+                for(auto *curr = node->data; curr; curr = curr->next) {
+                    names->erase(name_table::data_scope(node), curr->identifier);
+                }
+
+                for(auto *curr = node->func; curr; curr = curr->next) {
+                    names->erase(name_table::func_scope(node), curr->identifier);
+                }
+            }
+
             unregister_prop(&internal::type_info<Type>::type->prop);
             unregister_all<&internal::type_node::base>(0);
             unregister_all<&internal::type_node::conv>(0);
@@ -826,6 +1019,7 @@ public:
             internal::type_info<Type>::type->identifier = {};
             internal::type_info<Type>::type->next = nullptr;
             internal::type_info<Type>::type = nullptr;
+            ++internal::type_info<>::generation;
         }
 
         return registered;
@@ -848,7 +1042,7 @@ public:
  * @return A meta factory for the given type.
  */
 template<typename Type, typename... Property>
-inline factory<Type> reflect(const std::size_t identifier, Property &&... property) noexcept {
+inline factory<Type> reflect(const internal::named_identifier identifier, Property &&... property) noexcept {
     return factory<Type>{}.type(identifier, std::forward<Property>(property)...);
 }
 
@@ -870,6 +1064,54 @@ inline factory<Type> reflect() noexcept {
 }
 
 
+/**
+ * @brief Defers the reflection of a type until it's first needed.
+ *
+ * The registration function is invoked at most once, the first time the type
+ * is resolved, either directly or by means of its identifier, or when all the
+ * reflected types are iterated. It's expected to reflect the given type with
+ * the given identifier.<br/>
+ * This way, types that are never used in a process cost nothing more than a
+ * few pointers at startup.
+ *
+ * Types are resolved also when they appear in the signature of a meta object
+ * that is being registered, as an example as arguments of a meta function.
+ * Therefore, a registration function can run in the middle of the
+ * registration of another type. This is safe, as long as the two functions
+ * don't reflect the same type.
+ *
+ * @warning
+ * The type must not have been resolved or deferred yet. Otherwise, the request
+ * is refused and the registration function is never invoked.
+ *
+ * @tparam Type Type to reflect.
+ * @param identifier Unique identifier.
+ * @param thunk A function that reflects the given type.
+ * @return True if the registration is deferred, false otherwise.
+ */
+template<typename Type>
+inline bool defer(const std::size_t identifier, void(* thunk)()) noexcept {
+    static internal::deferred_node node{
+        nullptr,
+        {},
+        nullptr,
+        &internal::type_info<Type>::resolve
+    };
+
+    const bool accepted = thunk && !internal::type_info<Type>::type && !internal::type_info<Type>::deferred;
+
+    if(accepted) {
+        node.identifier = identifier;
+        node.thunk = thunk;
+        node.next = internal::type_info<>::deferred;
+        internal::type_info<Type>::deferred = &node;
+        internal::type_info<>::deferred = &node;
+    }
+
+    return accepted;
+}
+
+
 /**
  * @brief Utility function to unregister a type.
  *
@@ -895,7 +1137,7 @@ inline bool unregister() noexcept {
  */
 template<typename Type>
 inline type resolve() noexcept {
-    return internal::type_info<Type>::resolve()->clazz();
+    return internal::type_info<Type>::resolve()->ops->clazz();
 }
 
 
@@ -905,11 +1147,18 @@ inline type resolve() noexcept {
  * @return The meta type associated with the given identifier, if any.
  */
 inline type resolve(const std::size_t identifier) noexcept {
-    const auto *curr = internal::find_if([identifier](auto *node) {
+    const auto match = [identifier](auto *node) {
         return node->identifier == identifier;
-    }, internal::type_info<>::type);
+    };
+
+    const auto *curr = internal::find_if(match, internal::type_info<>::type);
 
-    return curr ? curr->clazz() : type{};
+    if(const auto *pending = curr ? nullptr : internal::find_if(match, internal::type_info<>::deferred); pending) {
+        curr = pending->resolve();
+        curr = (curr->identifier == identifier) ? curr : internal::find_if(match, internal::type_info<>::type);
+    }
+
+    return curr ? curr->ops->clazz() : type{};
 }
 
 
@@ -921,8 +1170,10 @@ inline type resolve(const std::size_t identifier) noexcept {
 template<typename Op>
 inline std::enable_if_t<std::is_invocable_v<Op, type>, void>
 resolve(Op op) noexcept {
+    internal::resolve_deferred();
+
     internal::iterate([op = std::move(op)](auto *node) {
-        op(node->clazz());
+        op(node->ops->clazz());
     }, internal::type_info<>::type);
 }
 
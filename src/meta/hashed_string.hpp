@@ -0,0 +1,257 @@
+#ifndef META_HASHED_STRING_HPP
+#define META_HASHED_STRING_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace meta {
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+struct fnv1a_traits {
+    static constexpr std::uint64_t offset = 14695981039346656037ull;
+    static constexpr std::uint64_t prime = 1099511628211ull;
+};
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+/**
+ * @brief Zero overhead unique identifier.
+ *
+ * A hashed string is a compile-time tool that allows users to use
+ * human-readable identifiers in the codebase while using their numeric
+ * counterparts at runtime.<br/>
+ * Because of that, a hashed string can also be used in constant expressions if
+ * required, as an example to pass identifiers to meta objects.
+ *
+ * Identifiers are computed with the 64-bit FNV-1a algorithm on the bytes of
+ * the string. Therefore, they don't depend on the standard library nor on the
+ * platform in use. Where `std::size_t` is narrower, identifiers are the lower
+ * bits of the same hash.
+ */
+class hashed_string {
+    using traits_type = internal::fnv1a_traits;
+
+    struct const_wrapper {
+        // non-explicit constructor on purpose
+        constexpr const_wrapper(const char *curr) noexcept: str{curr} {}
+        const char *str;
+    };
+
+    static constexpr std::size_t helper(const char *curr, std::size_t size) noexcept {
+        std::uint64_t partial{traits_type::offset};
+
+        for(std::size_t pos{}; pos < size; ++pos) {
+            partial = (partial ^ static_cast<unsigned char>(curr[pos])) * traits_type::prime;
+        }
+
+        return static_cast<std::size_t>(partial);
+    }
+
+    static constexpr std::size_t length(const char *str) noexcept {
+        std::size_t size{};
+
+        while(str[size]) {
+            ++size;
+        }
+
+        return size;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using hash_type = std::size_t;
+
+    /**
+     * @brief Returns directly the numeric representation of a string.
+     *
+     * Forcing template resolution avoids implicit conversions. An
+     * human-readable identifier can be anything but a plain, old bunch of
+     * characters.<br/>
+     * Example of use:
+     * @code{.cpp}
+     * const auto value = meta::hashed_string::value("my_type");
+     * @endcode
+     *
+     * @tparam N Number of characters of the identifier.
+     * @param str Human-readable identifier.
+     * @return The numeric representation of the string.
+     */
+    template<std::size_t N>
+    static constexpr hash_type value(const char (&str)[N]) noexcept {
+        return helper(str, N - 1u);
+    }
+
+    /**
+     * @brief Returns directly the numeric representation of a string.
+     * @param wrapper Helps achieving the purpose by relying on overloading.
+     * @return The numeric representation of the string.
+     */
+    static constexpr hash_type value(const_wrapper wrapper) noexcept {
+        return helper(wrapper.str, length(wrapper.str));
+    }
+
+    /**
+     * @brief Returns directly the numeric representation of a string view.
+     * @param str Human-readable identifier.
+     * @param size Length of the string to hash.
+     * @return The numeric representation of the string.
+     */
+    static constexpr hash_type value(const char *str, const std::size_t size) noexcept {
+        return helper(str, size);
+    }
+
+    /*! @brief Constructs an empty hashed string. */
+    constexpr hashed_string() noexcept
+        : str{nullptr}, len{}, hash{}
+    {}
+
+    /**
+     * @brief Constructs a hashed string from an array of const chars.
+     *
+     * Forcing template resolution avoids implicit conversions. An
+     * human-readable identifier can be anything but a plain, old bunch of
+     * characters.<br/>
+     * Example of use:
+     * @code{.cpp}
+     * meta::hashed_string hs{"my_type"};
+     * @endcode
+     *
+     * @tparam N Number of characters of the identifier.
+     * @param curr Human-readable identifier.
+     */
+    template<std::size_t N>
+    constexpr hashed_string(const char (&curr)[N]) noexcept
+        : str{curr}, len{N - 1u}, hash{value(curr)}
+    {}
+
+    /**
+     * @brief Constructs a hashed string from a string of a given length.
+     *
+     * The string isn't required to be null-terminated, though data returns a
+     * pointer to it as is.
+     *
+     * @param curr Human-readable identifier.
+     * @param size Length of the string to hash.
+     */
+    constexpr hashed_string(const char *curr, const std::size_t size) noexcept
+        : str{curr}, len{size}, hash{value(curr, size)}
+    {}
+
+    /**
+     * @brief Explicit constructor on purpose to avoid constructing a hashed
+     * string directly from a `const char *`.
+     * @param wrapper Helps achieving the purpose by relying on overloading.
+     */
+    explicit constexpr hashed_string(const_wrapper wrapper) noexcept
+        : str{wrapper.str}, len{length(wrapper.str)}, hash{value(wrapper)}
+    {}
+
+    /**
+     * @brief Returns the human-readable representation of a hashed string.
+     *
+     * The string isn't copied. It's meant to be used for diagnostic purposes
+     * and is valid as long as the original string is.
+     *
+     * @return The string used to initialize the instance.
+     */
+    constexpr const char * data() const noexcept {
+        return str;
+    }
+
+    /**
+     * @brief Returns the length of the human-readable representation of a
+     * hashed string.
+     * @return The number of characters hashed, terminator excluded.
+     */
+    constexpr std::size_t size() const noexcept {
+        return len;
+    }
+
+    /**
+     * @brief Returns the numeric representation of a hashed string.
+     * @return The numeric representation of the instance.
+     */
+    constexpr hash_type value() const noexcept {
+        return hash;
+    }
+
+    /*! @copydoc value */
+    constexpr operator hash_type() const noexcept {
+        return value();
+    }
+
+    /**
+     * @brief Compares two hashed strings.
+     * @param other Hashed string with which to compare.
+     * @return True if the two hashed strings are identical, false otherwise.
+     */
+    constexpr bool operator==(const hashed_string &other) const noexcept {
+        return hash == other.hash;
+    }
+
+private:
+    const char *str;
+    std::size_t len;
+    hash_type hash;
+};
+
+
+/**
+ * @brief Compares two hashed strings.
+ * @param lhs A valid hashed string.
+ * @param rhs A valid hashed string.
+ * @return True if the two hashed strings are identical, false otherwise.
+ */
+constexpr bool operator!=(const hashed_string &lhs, const hashed_string &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+
+/**
+ * @brief User defined literals of the library.
+ *
+ * They are opt-in and must be made available explicitly:
+ * @code{.cpp}
+ * using namespace meta::literals;
+ * @endcode
+ */
+namespace literals {
+
+
+/**
+ * @brief User defined literal for hashed strings.
+ * @param str The literal without its suffix.
+ * @param size Length of the literal.
+ * @return A properly initialized hashed string.
+ */
+constexpr hashed_string operator"" _hs(const char *str, std::size_t size) noexcept {
+    return hashed_string{str, size};
+}
+
+
+}
+
+
+}
+
+
+#endif // META_HASHED_STRING_HPP
@@ -0,0 +1,637 @@
+#ifndef META_JSON_HPP
+#define META_JSON_HPP
+
+
+#include <string>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <charconv>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include "meta.hpp"
+
+
+namespace meta {
+
+
+/**
+ * @brief Property keys used by the JSON reader and writer.
+ *
+ * The value of a property with key `json_property::name` is the name of a
+ * meta data in a JSON object. It must be either a `const char *` or a
+ * `std::string_view`. Meta data without a name aren't read nor written.
+ */
+enum class json_property {
+    name
+};
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename... Type, typename Func>
+bool json_visit(any &value, Func func) {
+    return ([&value, &func](auto *instance) {
+        return instance ? (func(*instance), true) : false;
+    }(value.try_cast<Type>()) || ...);
+}
+
+
+template<typename Func>
+bool json_arithmetic(any &value, Func func) {
+    return json_visit<
+        bool, char, signed char, unsigned char, short, unsigned short, int, unsigned int,
+        long, unsigned long, long long, unsigned long long, float, double, long double
+    >(value, std::move(func));
+}
+
+
+inline std::byte * json_address(const meta::data &field, handle instance, const bool writable) noexcept {
+    // members with a known offset are accessed in place rather than copied
+    const bool known = field.offset() != meta::data::npos && instance.type() == field.parent() && !(writable && field.is_const());
+    return known ? static_cast<std::byte *>(instance.data()) + field.offset() : nullptr;
+}
+
+
+inline std::string_view json_name(const meta::data &field) {
+    std::string_view name{};
+
+    if(auto prop = field.prop(json_property::name); prop) {
+        if(auto value = prop.value(); value.try_cast<const char *>()) {
+            name = value.cast<const char *>();
+        } else if(value.try_cast<std::string_view>()) {
+            name = value.cast<std::string_view>();
+        }
+    }
+
+    return name;
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+/**
+ * @brief Streaming JSON writer for reflected objects.
+ *
+ * Objects are written to an internal fixed size buffer that is handed to the
+ * sink every time it fills up, as well as on flush and on destruction. No
+ * intermediate representation is built, therefore the memory in use doesn't
+ * depend on the size of the output. Members with a known offset are read in
+ * place, the others are copied through their getters.<br/>
+ * The sink is any callable object that accepts a pointer to a sequence of
+ * characters and its length, such as a function that appends them to a
+ * string or writes them to a file descriptor.
+ *
+ * The following types are supported:
+ *
+ * * Arithmetic types, written as numbers or booleans. Non finite floating
+ *   point values are written as `null`.
+ * * `std::string`, `std::string_view` and `const char *`, written as strings.
+ * * Types with meta data, written as objects whose members are the meta data
+ *   that have a name (see `json_property`). Arrays are written as such.
+ *
+ * @tparam Sink Type of the callable object that receives the output.
+ */
+template<typename Sink>
+class json_writer {
+    static constexpr std::size_t buffer_size = 4096u;
+
+    void put(const char *str, const std::size_t length) {
+        if(length > buffer_size - count) {
+            flush();
+        }
+
+        if(length > buffer_size) {
+            sink(str, length);
+        } else if(length) {
+            std::memcpy(buffer + count, str, length);
+            count += length;
+        }
+    }
+
+    void put(const char ch) {
+        put(&ch, 1u);
+    }
+
+    void string(const std::string_view str) {
+        static constexpr char hex[] = "0123456789abcdef";
+        std::size_t first{};
+        put('"');
+
+        for(std::size_t pos{}; pos < str.size(); ++pos) {
+            if(const auto ch = static_cast<unsigned char>(str[pos]); ch < 0x20u || ch == '"' || ch == '\\') {
+                put(str.data() + first, pos - first);
+                first = pos + 1u;
+
+                switch(ch) {
+                case '"':
+                    put("\\\"", 2u);
+                    break;
+                case '\\':
+                    put("\\\\", 2u);
+                    break;
+                case '\n':
+                    put("\\n", 2u);
+                    break;
+                case '\r':
+                    put("\\r", 2u);
+                    break;
+                case '\t':
+                    put("\\t", 2u);
+                    break;
+                default:
+                    const char escaped[]{'\\', 'u', '0', '0', hex[ch >> 4u], hex[ch & 0xFu]};
+                    put(escaped, sizeof(escaped));
+                    break;
+                }
+            }
+        }
+
+        put(str.data() + first, str.size() - first);
+        put('"');
+    }
+
+    template<typename Type>
+    void number(const Type value) {
+        if constexpr(std::is_same_v<Type, bool>) {
+            value ? put("true", 4u) : put("false", 5u);
+        } else {
+            if constexpr(std::is_floating_point_v<Type>) {
+                if(!std::isfinite(value)) {
+                    put("null", 4u);
+                    return;
+                }
+            }
+
+            char str[64];
+            const auto result = std::to_chars(str, str + sizeof(str), value);
+            put(str, std::size_t(result.ptr - str));
+        }
+    }
+
+    bool object(handle instance) {
+        bool done = true;
+        bool first = true;
+        put('{');
+
+        instance.type().data([this, &instance, &done, &first](meta::data field) {
+            if(const auto name = internal::json_name(field); done && !name.empty() && !field.is_static()) {
+                if(!first) {
+                    put(',');
+                }
+
+                first = false;
+                string(name);
+                put(':');
+
+                auto *address = internal::json_address(field, instance, false);
+
+                if(const auto type = field.type(); type.is_array()) {
+                    const auto elem_type = type.remove_extent();
+                    put('[');
+
+                    for(std::size_t pos{}; done && pos < type.extent(); ++pos) {
+                        if(pos) {
+                            put(',');
+                        }
+
+                        any elem = address ? any{handle{elem_type, address + pos * elem_type.size_of()}} : field.get(instance, pos);
+                        done = value(elem);
+                    }
+
+                    put(']');
+                } else {
+                    any elem = address ? any{handle{type, address}} : field.get(instance);
+                    done = value(elem);
+                }
+            }
+        });
+
+        put('}');
+        return done;
+    }
+
+    bool value(any &instance) {
+        bool done = static_cast<bool>(instance);
+
+        if(done && !internal::json_arithmetic(instance, [this](auto value) { number(value); })) {
+            if(const auto *str = instance.try_cast<std::string>(); str) {
+                string(*str);
+            } else if(const auto *view = instance.try_cast<std::string_view>(); view) {
+                string(*view);
+            } else if(const auto *chars = instance.try_cast<const char *>(); chars) {
+                *chars ? string(*chars) : put("null", 4u);
+            } else {
+                done = instance.type().is_class() && object(instance);
+            }
+        }
+
+        return done;
+    }
+
+public:
+    /**
+     * @brief Constructs a writer for a given sink.
+     * @param sink A callable object that receives the output.
+     */
+    explicit json_writer(Sink sink)
+        : sink{std::move(sink)},
+          count{}
+    {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    json_writer(const json_writer &) = delete;
+
+    /**
+     * @brief Flushes the pending output on destruction.
+     *
+     * Exceptions thrown by the sink are swallowed. Call flush explicitly
+     * beforehand to be notified of them.
+     */
+    ~json_writer() {
+        try {
+            flush();
+        } catch(...) {
+            // destructors must not throw
+        }
+    }
+
+    /*! @brief Default copy assignment operator, deleted on purpose. */
+    json_writer & operator=(const json_writer &) = delete;
+
+    /**
+     * @brief Writes an object as a JSON value.
+     *
+     * The output is undefined in case of errors, that is when the object or
+     * any of its members isn't of a supported type.
+     *
+     * @param instance A handle to the object to write.
+     * @return True in case of success, false otherwise.
+     */
+    bool write(handle instance) {
+        any ref{instance};
+        return value(ref);
+    }
+
+    /*! @brief Hands the pending output to the sink, if any. */
+    void flush() {
+        if(count) {
+            sink(static_cast<const char *>(buffer), count);
+            count = {};
+        }
+    }
+
+private:
+    Sink sink;
+    std::size_t count;
+    char buffer[buffer_size];
+};
+
+
+/**
+ * @brief Streaming JSON reader for reflected objects.
+ *
+ * The input is parsed in a single pass and values are assigned to the members
+ * of the target object as they are found. No intermediate representation is
+ * built. Members are looked up by name through a hashed index that is created
+ * the first time a type is met and reused afterwards. Therefore, a reader
+ * must not outlive the registration of the types it has visited.<br/>
+ * Members with a known offset are parsed in place. The others are copied
+ * through their getters and assigned back through their setters.<br/>
+ * Members that aren't reflected or that have no name are skipped, as well as
+ * `null` values. Members that don't appear in the input are left untouched.
+ *
+ * Supported types are the same as for the JSON writer, except for
+ * `std::string_view` and `const char *` that cannot be read back.<br/>
+ * Numbers must follow the JSON grammar, hence `inf`, `nan`, hexadecimal values
+ * and leading `+` signs are rejected. Skipped values are validated as well.
+ *
+ * @warning
+ * The reader isn't incremental. The whole document must be available as a
+ * single contiguous string for the duration of a call to `read`, there is no
+ * way to feed it in chunks or to resume a partial parse.
+ */
+class json_reader {
+    using index = std::unordered_map<std::string_view, meta::data>;
+
+    const index & lookup(const meta::type &type) {
+        auto [it, created] = indexes.try_emplace(type.node);
+
+        if(created) {
+            type.data([&fields = it->second](meta::data field) {
+                if(const auto name = internal::json_name(field); !name.empty() && !field.is_static()) {
+                    fields.emplace(name, field);
+                }
+            });
+        }
+
+        return it->second;
+    }
+
+    meta::data field(const meta::type &type, const std::string_view name) {
+        const auto &fields = lookup(type);
+        const auto it = fields.find(name);
+        return it == fields.cend() ? meta::data{} : it->second;
+    }
+
+    void skip() {
+        while(pos < input.size() && (input[pos] == ' ' || input[pos] == '\t' || input[pos] == '\n' || input[pos] == '\r')) {
+            ++pos;
+        }
+    }
+
+    bool consume(const char ch) {
+        skip();
+        const bool done = pos < input.size() && input[pos] == ch;
+        pos += done;
+        return done;
+    }
+
+    bool literal(const std::string_view str) {
+        skip();
+        const bool done = input.substr(pos, str.size()) == str;
+        pos += done * str.size();
+        return done;
+    }
+
+    bool hex(std::uint32_t &code) {
+        const auto *first = input.data() + pos;
+        const auto result = pos + 4u <= input.size() ? std::from_chars(first, first + 4u, code, 16) : std::from_chars_result{first, std::errc::invalid_argument};
+        const bool done = result.ec == std::errc{} && result.ptr == first + 4u;
+        pos += done * 4u;
+        return done;
+    }
+
+    void utf8(std::string &out, const std::uint32_t code) {
+        if(code < 0x80u) {
+            out.push_back(char(code));
+        } else if(code < 0x800u) {
+            out.push_back(char(0xC0u | (code >> 6u)));
+            out.push_back(char(0x80u | (code & 0x3Fu)));
+        } else if(code < 0x10000u) {
+            out.push_back(char(0xE0u | (code >> 12u)));
+            out.push_back(char(0x80u | ((code >> 6u) & 0x3Fu)));
+            out.push_back(char(0x80u | (code & 0x3Fu)));
+        } else {
+            out.push_back(char(0xF0u | (code >> 18u)));
+            out.push_back(char(0x80u | ((code >> 12u) & 0x3Fu)));
+            out.push_back(char(0x80u | ((code >> 6u) & 0x3Fu)));
+            out.push_back(char(0x80u | (code & 0x3Fu)));
+        }
+    }
+
+    bool string(std::string &out) {
+        bool done = consume('"');
+        out.clear();
+
+        while(done && pos < input.size() && input[pos] != '"') {
+            if(const auto first = pos; input[pos] != '\\') {
+                for(; pos < input.size() && input[pos] != '"' && input[pos] != '\\'; ++pos);
+                out.append(input.data() + first, pos - first);
+            } else if(++pos < input.size()) {
+                switch(const auto ch = input[pos++]; ch) {
+                case '"':
+                case '\\':
+                case '/':
+                    out.push_back(ch);
+                    break;
+                case 'b':
+                    out.push_back('\b');
+                    break;
+                case 'f':
+                    out.push_back('\f');
+                    break;
+                case 'n':
+                    out.push_back('\n');
+                    break;
+                case 'r':
+                    out.push_back('\r');
+                    break;
+                case 't':
+                    out.push_back('\t');
+                    break;
+                case 'u': {
+                    std::uint32_t code{};
+
+                    if((done = hex(code)) && code >= 0xD800u && code < 0xDC00u) {
+                        std::uint32_t low{};
+                        done = input.substr(pos, 2u) == "\\u" && (pos += 2u, hex(low)) && low >= 0xDC00u && low < 0xE000u;
+                        code = 0x10000u + ((code - 0xD800u) << 10u) + (low - 0xDC00u);
+                    } else if(code >= 0xDC00u && code < 0xE000u) {
+                        // low surrogates cannot appear on their own
+                        done = false;
+                    }
+
+                    if(done) {
+                        utf8(out, code);
+                    }
+                } break;
+                default:
+                    done = false;
+                    break;
+                }
+            }
+        }
+
+        return done && consume('"');
+    }
+
+    std::size_t digits(std::size_t curr) const {
+        for(; curr < input.size() && input[curr] >= '0' && input[curr] <= '9'; ++curr);
+        return curr;
+    }
+
+    std::size_t token() const {
+        // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?, no inf, nan or hex
+        std::size_t last = pos + (pos < input.size() && input[pos] == '-');
+        std::size_t next = last < input.size() && input[last] == '0' ? (last + 1u) : digits(last);
+        bool valid = next != last;
+
+        if(last = next; valid && last < input.size() && input[last] == '.') {
+            next = digits(last + 1u);
+            valid = next != last + 1u;
+        }
+
+        if(last = next; valid && last < input.size() && (input[last] == 'e' || input[last] == 'E')) {
+            last += last + 1u < input.size() && (input[last + 1u] == '+' || input[last + 1u] == '-');
+            next = digits(last + 1u);
+            valid = next != last + 1u;
+        }
+
+        return valid ? (next - pos) : 0u;
+    }
+
+    template<typename Type>
+    bool number(Type &value) {
+        skip();
+        bool done = false;
+
+        if constexpr(std::is_same_v<Type, bool>) {
+            if(literal("true")) {
+                done = (value = true, true);
+            } else if(literal("false")) {
+                done = (value = false, true);
+            }
+        } else {
+            const auto *first = input.data() + pos;
+            const auto *last = first + token();
+            Type parsed{};
+
+            if(const auto result = std::from_chars(first, last, parsed); (done = first != last && result.ec == std::errc{} && result.ptr == last)) {
+                pos += std::size_t(last - first);
+                value = parsed;
+            }
+        }
+
+        return done;
+    }
+
+    bool discard() {
+        skip();
+        bool done = pos < input.size();
+
+        if(done && input[pos] == '"') {
+            done = string(scratch);
+        } else if(done && (input[pos] == '{' || input[pos] == '[')) {
+            const char close = input[pos++] == '{' ? '}' : ']';
+
+            if(!consume(close)) {
+                do {
+                    if(close == '}') {
+                        done = string(scratch) && consume(':');
+                    }
+
+                    done = done && discard();
+                } while(done && consume(','));
+
+                done = done && consume(close);
+            }
+        } else if(done) {
+            const auto len = token();
+            pos += len;
+            done = len || literal("true") || literal("false") || literal("null");
+        }
+
+        return done;
+    }
+
+    bool member(handle instance, const meta::data &field) {
+        bool done = true;
+
+        if(literal("null")) {
+            // null values leave members untouched
+        } else if(const auto type = field.type(); type.is_array()) {
+            auto *address = internal::json_address(field, instance, true);
+            const auto elem_type = type.remove_extent();
+            done = consume('[');
+
+            for(std::size_t idx{}; done && !consume(']'); ++idx) {
+                if((done = (!idx || consume(',')) && idx < type.extent())) {
+                    any elem = address ? any{handle{elem_type, address + idx * elem_type.size_of()}} : field.get(instance, idx);
+                    done = elem && value(elem) && (address || field.is_const() || field.set(instance, idx, elem));
+                }
+            }
+        } else {
+            auto *address = internal::json_address(field, instance, true);
+            any elem = address ? any{handle{type, address}} : field.get(instance);
+            done = elem && value(elem) && (address || field.is_const() || field.set(instance, elem));
+        }
+
+        return done;
+    }
+
+    bool object(handle instance) {
+        bool done = consume('{');
+
+        if(done && !consume('}')) {
+            std::string name{};
+
+            do {
+                done = string(name) && consume(':');
+
+                if(const auto curr = done ? field(instance.type(), name) : meta::data{}; curr) {
+                    done = member(instance, curr);
+                } else if(done) {
+                    done = discard();
+                }
+            } while(done && consume(','));
+
+            done = done && consume('}');
+        }
+
+        return done;
+    }
+
+    bool value(any &instance) {
+        bool done = true;
+
+        if(!internal::json_arithmetic(instance, [this, &done](auto &value) { done = number(value); })) {
+            if(auto *str = instance.try_cast<std::string>(); str) {
+                done = string(*str);
+            } else {
+                done = instance.type().is_class() && object(instance);
+            }
+        }
+
+        return done;
+    }
+
+public:
+    /*! @brief Default constructor. */
+    json_reader()
+        : indexes{},
+          scratch{},
+          input{},
+          pos{}
+    {}
+
+    /**
+     * @brief Reads a JSON value into an object.
+     *
+     * The object is modified in place. In case of errors, the members read so
+     * far keep their new values.
+     *
+     * @param json The JSON text to parse.
+     * @param instance A handle to the object to fill.
+     * @return True in case of success, false otherwise.
+     */
+    bool read(const std::string_view json, handle instance) {
+        input = json;
+        pos = {};
+
+        any ref{instance};
+        const bool done = ref && value(ref);
+        skip();
+
+        return done && pos == input.size();
+    }
+
+private:
+    std::unordered_map<const internal::type_node *, index> indexes;
+    std::string scratch;
+    std::string_view input;
+    std::size_t pos;
+};
+
+
+}
+
+
+#endif // META_JSON_HPP
@@ -2,13 +2,39 @@
 #define META_META_HPP
 
 
+#include <new>
 #include <array>
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <iterator>
 #include <cstring>
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <type_traits>
 #include <cassert>
+#if defined(META_TRACE) || defined(META_COUNTERS)
+#include <chrono>
+#endif
+#ifdef META_COUNTERS
+#include <atomic>
+#endif
+
+
+#ifdef _MSC_VER
+// the linker catches translation units with different configurations
+#ifdef META_COUNTERS
+#pragma detect_mismatch("meta_counters", "on")
+#else
+#pragma detect_mismatch("meta_counters", "off")
+#endif
+#ifdef META_TRACE
+#pragma detect_mismatch("meta_trace", "on")
+#else
+#pragma detect_mismatch("meta_trace", "off")
+#endif
+#endif
 
 
 namespace meta {
@@ -24,6 +50,119 @@ class dtor;
 class data;
 class func;
 class type;
+class call_site;
+class column;
+class json_reader;
+class name_table;
+
+
+/*! @brief Events reported to the tracing hook, if any. */
+enum class trace_event {
+    /*! @brief A meta function has been invoked. */
+    invoke,
+    /*! @brief A meta data has been read. */
+    get,
+    /*! @brief A meta data has been written. */
+    set,
+    /*! @brief An instance of a meta type has been constructed. */
+    construct,
+    /*! @brief An instance has been converted to another type. */
+    convert,
+    /*! @brief An instance couldn't be cast to the requested type. */
+    cast
+};
+
+
+#ifdef META_COUNTERS
+/*! @brief Counters of a meta function or a meta data. */
+struct member_stats {
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Number of buckets of the latency histogram.
+     *
+     * Buckets are decades of nanoseconds: below 100ns, below 1us, below 10us,
+     * below 100us, below 1ms and anything else.
+     */
+    static constexpr size_type buckets = 6u;
+
+    /*! @brief Number of calls. */
+    size_type calls;
+    /*! @brief Number of calls that failed. */
+    size_type failures;
+    /*! @brief Number of arguments or values actually converted. */
+    size_type conversions;
+    /*! @brief Latency histogram of the calls. */
+    std::array<size_type, buckets> latency;
+};
+#endif
+
+
+#ifdef META_TRACE
+struct trace_record;
+
+
+/*! @brief Type of functions invoked when tracing events. */
+using trace_hook = void(const trace_record &);
+#endif
+
+
+/*! @brief Traits of a meta type, packed as a set of flags. */
+enum class type_traits: std::uint32_t {
+    /*! @brief Empty set of traits. */
+    none = 0u,
+    /*! @brief The type is void. */
+    is_void = 1u << 0u,
+    /*! @brief The type is an integral type. */
+    is_integral = 1u << 1u,
+    /*! @brief The type is a floating point type. */
+    is_floating_point = 1u << 2u,
+    /*! @brief The type is an array type. */
+    is_array = 1u << 3u,
+    /*! @brief The type is an enum. */
+    is_enum = 1u << 4u,
+    /*! @brief The type is an union. */
+    is_union = 1u << 5u,
+    /*! @brief The type is a class. */
+    is_class = 1u << 6u,
+    /*! @brief The type is a pointer. */
+    is_pointer = 1u << 7u,
+    /*! @brief The type is a pointer to function. */
+    is_function_pointer = 1u << 8u,
+    /*! @brief The type is a pointer to data member. */
+    is_member_object_pointer = 1u << 9u,
+    /*! @brief The type is a pointer to member function. */
+    is_member_function_pointer = 1u << 10u,
+    /*! @brief The type is trivially copyable. */
+    is_trivially_copyable = 1u << 11u,
+    /*! @brief The type is trivially destructible. */
+    is_trivially_destructible = 1u << 12u,
+    /*! @brief The type is default constructible. */
+    is_default_constructible = 1u << 13u
+};
+
+
+/**
+ * @brief Combines two sets of type traits.
+ * @param lhs A set of traits.
+ * @param rhs A set of traits.
+ * @return The union of the two sets.
+ */
+constexpr type_traits operator|(const type_traits lhs, const type_traits rhs) noexcept {
+    return type_traits(std::uint32_t(lhs) | std::uint32_t(rhs));
+}
+
+
+/**
+ * @brief Intersects two sets of type traits.
+ * @param lhs A set of traits.
+ * @param rhs A set of traits.
+ * @return The intersection of the two sets.
+ */
+constexpr type_traits operator&(const type_traits lhs, const type_traits rhs) noexcept {
+    return type_traits(std::uint32_t(lhs) & std::uint32_t(rhs));
+}
 
 
 /**
@@ -38,6 +177,16 @@ namespace internal {
 struct type_node;
 
 
+#ifdef META_COUNTERS
+struct counters_node {
+    std::atomic<std::size_t> calls;
+    std::atomic<std::size_t> failures;
+    std::atomic<std::size_t> conversions;
+    std::array<std::atomic<std::size_t>, member_stats::buckets> latency;
+};
+#endif
+
+
 struct prop_node {
     prop_node * next;
     any(* const key)();
@@ -73,8 +222,11 @@ struct ctor_node {
     ctor_node * next;
     prop_node * prop;
     const size_type size;
+    const std::size_t signature;
+    const bool is_strict;
     type_node *(* const arg)(size_type) noexcept;
     any(* const invoke)(any * const);
+    bool(* const construct)(void *, any * const);
     ctor(* const clazz)() noexcept;
 };
 
@@ -96,9 +248,14 @@ struct data_node {
     const bool is_const;
     const bool is_static;
     type_node *(* const ref)() noexcept;
-    bool(* const set)(handle, any, any);
-    any(* const get)(handle, any);
+    const std::size_t offset;
+    const void * const target;
+    bool(* const set)(const data_node &, handle, any, any);
+    any(* const get)(const data_node &, handle, any);
     data(* const clazz)() noexcept;
+#ifdef META_COUNTERS
+    mutable counters_node counters{};
+#endif
 };
 
 
@@ -110,35 +267,44 @@ struct func_node {
     func_node * next;
     prop_node * prop;
     const size_type size;
+    const std::size_t signature;
+    const bool is_strict;
     const bool is_const;
     const bool is_static;
     type_node *(* const ret)() noexcept;
     type_node *(* const arg)(size_type) noexcept;
-    any(* const invoke)(handle, any *);
+    const void * const target;
+    any(* const invoke)(const func_node &, handle, any *);
     func(* const clazz)() noexcept;
+#ifdef META_COUNTERS
+    mutable counters_node counters{};
+#endif
 };
 
 
-struct type_node {
+struct type_ops {
     using size_type = std::size_t;
-    std::size_t identifier;
-    type_node * next;
-    prop_node * prop;
-    const bool is_void;
-    const bool is_integral;
-    const bool is_floating_point;
-    const bool is_array;
-    const bool is_enum;
-    const bool is_union;
-    const bool is_class;
-    const bool is_pointer;
-    const bool is_function_pointer;
-    const bool is_member_object_pointer;
-    const bool is_member_function_pointer;
     const size_type extent;
+    const size_type size_of;
+    const size_type align_of;
     bool(* const compare)(const void *, const void *);
+    void(* const destroy_at)(void *);
+    void(* const copy_at)(void *, const void *);
+    void(* const move_at)(void *, void *);
+    any(* const clone)(const void *);
     type(* const remove_pointer)() noexcept;
+    type(* const remove_extent)() noexcept;
     type(* const clazz)() noexcept;
+};
+
+
+struct type_node {
+    using size_type = std::size_t;
+    std::size_t identifier;
+    type_node * next;
+    prop_node * prop;
+    const type_traits traits;
+    const type_ops * const ops;
     base_node *base{nullptr};
     conv_node *conv{nullptr};
     ctor_node *ctor{nullptr};
@@ -148,15 +314,31 @@ struct type_node {
 };
 
 
+struct deferred_node {
+    deferred_node * next;
+    std::size_t identifier;
+    void(* thunk)();
+    type_node *(* const resolve)() noexcept;
+};
+
+
 template<typename...>
 struct info_node {
     inline static type_node *type = nullptr;
+    inline static deferred_node *deferred = nullptr;
+    inline static name_table *names = nullptr;
+    inline static std::size_t generation = 0;
+    inline static unsigned int configurations = 0u;
+#ifdef META_TRACE
+    inline static trace_hook *tracer = nullptr;
+#endif
 };
 
 
 template<typename Type>
 struct info_node<Type> {
     inline static type_node *type = nullptr;
+    inline static deferred_node *deferred = nullptr;
 
     template<typename>
     inline static base_node *base = nullptr;
@@ -176,6 +358,9 @@ struct info_node<Type> {
     template<auto>
     inline static func_node *func = nullptr;
 
+    static const type_ops ops;
+    static type_node node;
+
     inline static type_node * resolve() noexcept;
 };
 
@@ -184,6 +369,164 @@ template<typename... Type>
 struct type_info: info_node<std::remove_cv_t<std::remove_reference_t<Type>>...> {};
 
 
+enum configuration: unsigned int {
+    counters_on = 1u,
+    counters_off = 2u,
+    trace_on = 4u,
+    trace_off = 8u
+};
+
+
+// each translation unit marks its configuration, a mix of them is caught when resolving types
+#ifdef META_COUNTERS
+inline const bool counters_enabled = (type_info<>::configurations |= counters_on, true);
+#else
+inline const bool counters_disabled = (type_info<>::configurations |= counters_off, true);
+#endif
+
+#ifdef META_TRACE
+inline const bool trace_enabled = (type_info<>::configurations |= trace_on, true);
+#else
+inline const bool trace_disabled = (type_info<>::configurations |= trace_off, true);
+#endif
+
+
+inline bool consistent_configuration() noexcept {
+    const auto curr = type_info<>::configurations;
+    return (curr & (counters_on | counters_off)) != (counters_on | counters_off) && (curr & (trace_on | trace_off)) != (trace_on | trace_off);
+}
+
+
+inline void resolve_deferred() noexcept {
+    while(auto *curr = type_info<>::deferred) {
+        curr->resolve();
+
+        // resolving a type unlinks its node, this guarantees progress in any case
+        if(type_info<>::deferred == curr) {
+            type_info<>::deferred = curr->next;
+            curr->next = nullptr;
+        }
+    }
+}
+
+
+#ifdef META_TRACE
+class trace_scope {
+    using clock_type = std::chrono::steady_clock;
+
+public:
+    trace_scope(const trace_event which, const void *curr, const type_node *target, const std::size_t id) noexcept
+        : hook{type_info<>::tracer},
+          event{which},
+          node{curr},
+          type{target},
+          identifier{id},
+          success{true},
+          start{hook ? clock_type::now() : clock_type::time_point{}}
+    {}
+
+    trace_scope(const trace_scope &) = delete;
+    ~trace_scope();
+
+    trace_scope & operator=(const trace_scope &) = delete;
+
+    void operator()(const bool result) noexcept {
+        success = result;
+    }
+
+    static void failure(const trace_event, const void *, const type_node *) noexcept;
+
+private:
+    trace_hook * const hook;
+    const trace_event event;
+    const void * const node;
+    const type_node * const type;
+    const std::size_t identifier;
+    bool success;
+    const clock_type::time_point start;
+};
+#else
+struct trace_scope {
+    constexpr trace_scope(const trace_event, const void *, const type_node *, const std::size_t) noexcept {}
+    constexpr void operator()(const bool) const noexcept {}
+    static constexpr void failure(const trace_event, const void *, const type_node *) noexcept {}
+};
+#endif
+
+
+#ifdef META_COUNTERS
+class counter_scope {
+    using clock_type = std::chrono::steady_clock;
+
+public:
+    template<typename Node>
+    counter_scope(const Node &node) noexcept
+        : counters{node.counters},
+          success{true},
+          start{clock_type::now()}
+    {}
+
+    counter_scope(const counter_scope &) = delete;
+
+    ~counter_scope() {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start).count();
+        std::size_t bucket{};
+
+        for(auto bound = 100; bucket < member_stats::buckets - 1u && elapsed >= bound; bound *= 10) {
+            ++bucket;
+        }
+
+        counters.calls.fetch_add(1u, std::memory_order_relaxed);
+        counters.failures.fetch_add(!success, std::memory_order_relaxed);
+        counters.latency[bucket].fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    counter_scope & operator=(const counter_scope &) = delete;
+
+    void operator()(const bool result) noexcept {
+        success = result;
+    }
+
+private:
+    counters_node &counters;
+    bool success;
+    const clock_type::time_point start;
+};
+#else
+struct counter_scope {
+    template<typename Node>
+    constexpr counter_scope(const Node &) noexcept {}
+    constexpr void operator()(const bool) const noexcept {}
+};
+#endif
+
+
+#ifdef META_COUNTERS
+inline member_stats stats_of(const counters_node &counters) noexcept {
+    member_stats stats{
+        counters.calls.load(std::memory_order_relaxed),
+        counters.failures.load(std::memory_order_relaxed),
+        counters.conversions.load(std::memory_order_relaxed),
+        {}
+    };
+
+    for(std::size_t pos{}; pos < member_stats::buckets; ++pos) {
+        stats.latency[pos] = counters.latency[pos].load(std::memory_order_relaxed);
+    }
+
+    return stats;
+}
+#endif
+
+
+template<typename Node>
+void count_conversions([[maybe_unused]] const Node &node, [[maybe_unused]] const std::size_t count) noexcept {
+#ifdef META_COUNTERS
+    node.counters.conversions.fetch_add(count, std::memory_order_relaxed);
+#endif
+}
+
+
 template<typename Op, typename Node>
 void iterate(Op op, const Node *curr) noexcept {
     while(curr) {
@@ -236,9 +579,7 @@ auto find_if(Op op, const type_node *node) noexcept
 }
 
 
-template<typename Type>
-const Type * try_cast(const type_node *node, void *instance) noexcept {
-    const auto *type = type_info<Type>::resolve();
+inline void * try_cast(const type_node *node, const type_node *type, void *instance) noexcept {
     void *ret = nullptr;
 
     if(node == type) {
@@ -251,7 +592,7 @@ const Type * try_cast(const type_node *node, void *instance) noexcept {
         ret = base ? base->cast(instance) : nullptr;
     }
 
-    return static_cast<const Type *>(ret);
+    return ret;
 }
 
 
@@ -263,15 +604,130 @@ inline bool can_cast_or_convert(const type_node *from, const type_node *to) noex
 }
 
 
-template<typename... Args, std::size_t... Indexes>
-inline auto ctor(std::index_sequence<Indexes...>, const type_node *node) noexcept {
-    return internal::find_if([](auto *candidate) {
-        return candidate->size == sizeof...(Args) &&
-                (([](auto *from, auto *to) {
-                    return internal::can_cast_or_convert<&internal::type_node::base>(from, to)
-                            || internal::can_cast_or_convert<&internal::type_node::conv>(from, to);
-                }(internal::type_info<Args>::resolve(), candidate->arg(Indexes))) && ...);
-    }, node->ctor);
+inline std::size_t signature(const std::size_t seed, const type_node *node) noexcept {
+    return seed ^ (reinterpret_cast<std::uintptr_t>(node) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+
+template<typename... Args>
+inline std::size_t signature() noexcept {
+    std::size_t seed{};
+    ((seed = signature(seed, type_info<Args>::resolve())), ...);
+    return seed;
+}
+
+
+template<typename Node>
+std::size_t cost(const Node *candidate, const type_node * const *args) noexcept {
+    constexpr auto none = std::numeric_limits<std::size_t>::max();
+    std::size_t total{};
+
+    for(typename Node::size_type pos{}; pos < candidate->size && total != none; ++pos) {
+        if(const auto *to = candidate->arg(pos); args[pos] != to) {
+            // strict candidates refuse conversions, they aren't viable if one is required
+            if(can_cast_or_convert<&type_node::base>(args[pos], to)) {
+                total += 1u;
+            } else if(!candidate->is_strict && can_cast_or_convert<&type_node::conv>(args[pos], to)) {
+                total += 2u;
+            } else {
+                total = none;
+            }
+        }
+    }
+
+    return total;
+}
+
+
+template<typename Node, typename Op>
+const Node * match(Op op, const Node *curr, const std::size_t signature, const type_node * const *args, const std::size_t size) noexcept {
+    const Node *candidate = find_if([&op, signature, args, size](auto *node) {
+        // signatures can collide, exact matches are confirmed on the nodes
+        return node->signature == signature && node->size == size && op(node) && !cost(node, args);
+    }, curr);
+
+    if(!candidate) {
+        for(auto best = std::numeric_limits<std::size_t>::max(); curr; curr = curr->next) {
+            if(curr->size == size && op(curr)) {
+                if(const auto score = cost(curr, args); score < best) {
+                    candidate = curr;
+                    best = score;
+                }
+            }
+        }
+    }
+
+    return candidate;
+}
+
+
+template<typename Op>
+const ctor_node * match_ctor(Op op, const type_node *node, const std::size_t signature, const type_node * const *args, const std::size_t size) noexcept {
+    // constructors of the base classes are used only if the type has none that fits
+    const ctor_node *candidate = match(op, node->ctor, signature, args, size);
+
+    for(auto *curr = node->base; curr && !candidate; curr = curr->next) {
+        candidate = match_ctor(op, curr->ref(), signature, args, size);
+    }
+
+    return candidate;
+}
+
+
+template<typename Node, std::size_t Size>
+struct dispatch_cache {
+    const void *owner{};
+    std::size_t identifier{};
+    std::size_t generation{};
+    std::array<const type_node *, Size> args{};
+    const Node *node{};
+};
+
+
+inline const func_node * overload(const type_node *node, const std::size_t identifier, const type_node * const *args, const std::size_t size) noexcept {
+    // overloads are contiguous within the first type of the hierarchy that has any, they hide those of the bases
+    const auto *curr = find_if<&type_node::func>([identifier](auto *candidate) {
+        return candidate->identifier == identifier;
+    }, node);
+
+    std::size_t signature{};
+    const func_node *candidate = nullptr;
+
+    for(std::size_t pos{}; pos < size; ++pos) {
+        signature = internal::signature(signature, args[pos]);
+    }
+
+    for(auto *it = curr; it && it->identifier == identifier && !candidate; it = it->next) {
+        candidate = (it->signature == signature && it->size == size && !cost(it, args)) ? it : nullptr;
+    }
+
+    if(!candidate) {
+        for(auto best = std::numeric_limits<std::size_t>::max(); curr && curr->identifier == identifier; curr = curr->next) {
+            if(curr->size == size) {
+                if(const auto score = cost(curr, args); score < best) {
+                    candidate = curr;
+                    best = score;
+                }
+            }
+        }
+    }
+
+    return candidate;
+}
+
+
+template<typename... Args>
+inline const ctor_node * ctor(const type_node *node) noexcept {
+    static thread_local dispatch_cache<ctor_node, sizeof...(Args)> cache{};
+
+    if(cache.owner != node || cache.generation != type_info<>::generation) {
+        cache.args = {{type_info<Args>::resolve()...}};
+        cache.node = match([](auto *) { return true; }, node->ctor, signature<Args...>(), cache.args.data(), cache.args.size());
+        cache.generation = type_info<>::generation;
+        cache.owner = node;
+    }
+
+    return cache.node;
 }
 
 
@@ -299,6 +755,10 @@ inline auto ctor(std::index_sequence<Indexes...>, const type_node *node) noexcep
 class any {
     /*! @brief A meta handle is allowed to _inherit_ from a meta any. */
     friend class handle;
+    /*! @brief A meta type is allowed to inspect the arguments it receives. */
+    friend class type;
+    /*! @brief A call site is allowed to inspect the arguments it receives. */
+    friend class call_site;
 
     using storage_type = std::aligned_storage_t<sizeof(void *), alignof(void *)>;
     using copy_fn_type = void *(storage_type &, const void *);
@@ -317,7 +777,7 @@ class any {
         static void destroy(void *instance) {
             auto *node = internal::type_info<Type>::resolve();
             auto *actual = static_cast<Type *>(instance);
-            [[maybe_unused]] const bool destroyed = node->clazz().destroy(*actual);
+            [[maybe_unused]] const bool destroyed = node->ops->clazz().destroy(*actual);
             assert(destroyed);
             delete actual;
         }
@@ -345,7 +805,7 @@ class any {
         static void destroy(void *instance) {
             auto *node = internal::type_info<Type>::resolve();
             auto *actual = static_cast<Type *>(instance);
-            [[maybe_unused]] const bool destroyed = node->clazz().destroy(*actual);
+            [[maybe_unused]] const bool destroyed = node->ops->clazz().destroy(*actual);
             assert(destroyed);
             actual->~Type();
         }
@@ -515,7 +975,15 @@ public:
      */
     template<typename Type>
     const Type * try_cast() const noexcept {
-        return internal::try_cast<Type>(node, instance);
+        const auto *type = internal::type_info<Type>::resolve();
+        const auto *ret = static_cast<const Type *>(internal::try_cast(node, type, instance));
+
+        if(!ret) {
+            // casts are too frequent to time them, only failures are reported
+            internal::trace_scope::failure(trace_event::cast, node, type);
+        }
+
+        return ret;
     }
 
     /*! @copydoc try_cast */
@@ -559,9 +1027,11 @@ public:
      */
     template<typename Type>
     any convert() const {
+        const auto *type = internal::type_info<Type>::resolve();
+        internal::trace_scope trace{trace_event::convert, node, type, {}};
         any any{};
 
-        if(const auto *type = internal::type_info<Type>::resolve(); node == type) {
+        if(node == type) {
             any = *static_cast<const Type *>(instance);
         } else {
             const auto *conv = internal::find_if<&internal::type_node::conv>([type](auto *other) {
@@ -573,6 +1043,7 @@ public:
             }
         }
 
+        trace(static_cast<bool>(any));
         return any;
     }
 
@@ -622,7 +1093,7 @@ public:
      * otherwise.
      */
     bool operator==(const any &other) const noexcept {
-        return node == other.node && (!node || node->compare(instance, other.instance));
+        return node == other.node && (!node || node->ops->compare(instance, other.instance));
     }
 
     /**
@@ -675,6 +1146,10 @@ private:
 class handle {
     /*! @brief A meta any is allowed to _inherit_ from a meta handle. */
     friend class any;
+    /*! @brief A call site is allowed to inspect its receivers. */
+    friend class call_site;
+    /*! @brief A meta data is allowed to reach data members directly. */
+    friend class data;
 
 public:
     /*! @brief Default constructor. */
@@ -703,6 +1178,17 @@ public:
           instance{&obj}
     {}
 
+    /**
+     * @brief Constructs a meta handle from a meta type and an opaque pointer.
+     *
+     * The instance must be an object of the given type. Otherwise, using the
+     * handle results in an undefined behavior.
+     *
+     * @param type The meta type of the object.
+     * @param obj An opaque pointer to an object of the given type.
+     */
+    inline handle(const meta::type &type, void *obj) noexcept;
+
     /**
      * @brief Returns the meta type of the underlying object.
      * @return The meta type of the underlying object, if any.
@@ -1024,6 +1510,7 @@ public:
      */
     template<typename... Args>
     any invoke(Args &&... args) const {
+        internal::trace_scope trace{trace_event::construct, node, node->parent, node->parent->identifier};
         std::array<any, sizeof...(Args)> arguments{{std::forward<Args>(args)...}};
         any any{};
 
@@ -1031,9 +1518,35 @@ public:
             any = node->invoke(arguments.data());
         }
 
+        trace(static_cast<bool>(any));
         return any;
     }
 
+    /**
+     * @brief Creates an instance of the underlying type directly into the
+     * given storage, if possible.
+     *
+     * The storage must be suitably sized and aligned for the underlying type
+     * and it doesn't have to contain a live object. Callers are responsible
+     * for the lifetime of the instance, if any is created.<br/>
+     * The types of the parameters must coincide with those required by the
+     * underlying meta constructor, or at least they must be castable or
+     * convertible to them. Otherwise, nothing is created.
+     *
+     * @tparam Args Types of arguments to use to construct the instance.
+     * @param storage A pointer to the storage to use for the new instance.
+     * @param args Parameters to use to construct the instance.
+     * @return True in case of success, false otherwise.
+     */
+    template<typename... Args>
+    bool construct_at(void *storage, Args &&... args) const {
+        internal::trace_scope trace{trace_event::construct, node, node->parent, node->parent->identifier};
+        std::array<any, sizeof...(Args)> arguments{{std::forward<Args>(args)...}};
+        const bool done = sizeof...(Args) == size() && node->construct(storage, arguments.data());
+        trace(done);
+        return done;
+    }
+
     /**
      * @brief Iterates all the properties assigned to a meta constructor.
      * @tparam Op Type of the function object to invoke.
@@ -1186,11 +1699,25 @@ class data {
     {}
 
 public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Offset of meta data that aren't part of the layout of a type. */
+    static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
     /*! @brief Default constructor. */
     data() noexcept
         : node{nullptr}
     {}
 
+    /**
+     * @brief Returns the identifier assigned to a given meta data.
+     * @return The identifier assigned to the meta data.
+     */
+    std::size_t identifier() const noexcept {
+        return node->identifier;
+    }
+
     /**
      * @brief Returns the meta type to which a meta data belongs.
      * @return The meta type to which the meta data belongs.
@@ -1223,6 +1750,24 @@ public:
      */
     inline meta::type type() const noexcept;
 
+    /**
+     * @brief Returns the offset in bytes of a meta data within its parent.
+     *
+     * Offsets are known only for data members assigned to their meta types
+     * as member object pointers with the default policy, when their parents
+     * are standard layout types. They are meant for tools that reason about
+     * the layout of objects, such as serializers, or that access the same data
+     * member of many objects at once.<br/>
+     * Data members with a known offset are also read and assigned in place,
+     * as long as the instance has exactly the parent type and, when assigning
+     * them, the value has exactly the type of the data member.
+     *
+     * @return The offset of the meta data, `npos` if unknown.
+     */
+    size_type offset() const noexcept {
+        return node->offset;
+    }
+
     /**
      * @brief Sets the value of the variable enclosed by a given meta type.
      *
@@ -1239,7 +1784,24 @@ public:
      */
     template<typename Type>
     bool set(handle handle, Type &&value) const {
-        return node->set(handle, any{}, std::forward<Type>(value));
+        using value_type = std::remove_cv_t<std::remove_reference_t<Type>>;
+        internal::trace_scope trace{trace_event::set, node, node->parent, node->identifier};
+        internal::counter_scope count{*node};
+
+        bool done = false;
+
+        if constexpr(std::is_copy_assignable_v<value_type> && !std::is_array_v<value_type> && !std::is_same_v<value_type, any> && !std::is_same_v<value_type, meta::handle>) {
+            // values of the exact type go straight to the data members of their parents
+            if(node->offset != npos && !node->is_const && node->ref() == internal::type_info<value_type>::resolve() && handle.node == node->parent) {
+                *reinterpret_cast<value_type *>(static_cast<std::byte *>(handle.data()) + node->offset) = std::forward<Type>(value);
+                done = true;
+            }
+        }
+
+        done = done || node->set(*node, handle, any{}, std::forward<Type>(value));
+        trace(done);
+        count(done);
+        return done;
     }
 
     /**
@@ -1259,8 +1821,13 @@ public:
      */
     template<typename Type>
     bool set(handle handle, std::size_t index, Type &&value) const {
-        assert(index < node->ref()->extent);
-        return node->set(handle, index, std::forward<Type>(value));
+        assert(index < node->ref()->ops->extent);
+        internal::trace_scope trace{trace_event::set, node, node->parent, node->identifier};
+        internal::counter_scope count{*node};
+        const bool done = node->set(*node, handle, index, std::forward<Type>(value));
+        trace(done);
+        count(done);
+        return done;
     }
 
     /**
@@ -1273,7 +1840,20 @@ public:
      * @return A meta any containing the value of the underlying variable.
      */
     any get(handle handle) const noexcept {
-        return node->get(handle, any{});
+        internal::trace_scope trace{trace_event::get, node, node->parent, node->identifier};
+        internal::counter_scope count{*node};
+        meta::any any{};
+
+        // data members of exact parents are copied straight from their addresses
+        if(const auto *ops = node->ref()->ops; node->offset != npos && ops->clone && handle.node == node->parent) {
+            any = ops->clone(static_cast<const std::byte *>(handle.data()) + node->offset);
+        } else {
+            any = node->get(*node, handle, meta::any{});
+        }
+
+        trace(static_cast<bool>(any));
+        count(static_cast<bool>(any));
+        return any;
     }
 
     /**
@@ -1287,8 +1867,13 @@ public:
      * @return A meta any containing the value of the underlying element.
      */
     any get(handle handle, std::size_t index) const noexcept {
-        assert(index < node->ref()->extent);
-        return node->get(handle, index);
+        assert(index < node->ref()->ops->extent);
+        internal::trace_scope trace{trace_event::get, node, node->parent, node->identifier};
+        internal::counter_scope count{*node};
+        auto any = node->get(*node, handle, index);
+        trace(static_cast<bool>(any));
+        count(static_cast<bool>(any));
+        return any;
     }
 
     /**
@@ -1320,6 +1905,21 @@ public:
         return curr ? curr->clazz() : meta::prop{};
     }
 
+#ifdef META_COUNTERS
+    /**
+     * @brief Returns the counters of a given meta data.
+     *
+     * Counters are available only when `META_COUNTERS` is defined. They
+     * account for reads and writes made through meta objects and for the
+     * values assigned that went through a conversion function.
+     *
+     * @return The counters of the meta data.
+     */
+    member_stats stats() const noexcept {
+        return internal::stats_of(node->counters);
+    }
+#endif
+
     /**
      * @brief Returns true if a meta object is valid, false otherwise.
      * @return True if the meta object is valid, false otherwise.
@@ -1377,6 +1977,14 @@ public:
         : node{nullptr}
     {}
 
+    /**
+     * @brief Returns the identifier assigned to a given meta function.
+     * @return The identifier assigned to the meta function.
+     */
+    std::size_t identifier() const noexcept {
+        return node->identifier;
+    }
+
     /**
      * @brief Returns the meta type to which a meta function belongs.
      * @return The meta type to which the meta function belongs.
@@ -1446,7 +2054,11 @@ public:
         any any{};
 
         if(sizeof...(Args) == size()) {
-            any = node->invoke(handle, arguments.data());
+            internal::trace_scope trace{trace_event::invoke, node, node->parent, node->identifier};
+            internal::counter_scope count{*node};
+            any = node->invoke(*node, handle, arguments.data());
+            trace(static_cast<bool>(any));
+            count(static_cast<bool>(any));
         }
 
         return any;
@@ -1481,6 +2093,21 @@ public:
         return curr ? curr->clazz() : meta::prop{};
     }
 
+#ifdef META_COUNTERS
+    /**
+     * @brief Returns the counters of a given meta function.
+     *
+     * Counters are available only when `META_COUNTERS` is defined. They
+     * account for invocations made through meta objects and for the
+     * arguments that went through a conversion function.
+     *
+     * @return The counters of the meta function.
+     */
+    member_stats stats() const noexcept {
+        return internal::stats_of(node->counters);
+    }
+#endif
+
     /**
      * @brief Returns true if a meta object is valid, false otherwise.
      * @return True if the meta object is valid, false otherwise.
@@ -1524,6 +2151,14 @@ inline bool operator!=(const func &lhs, const func &rhs) noexcept {
 class type {
     /*! @brief A meta node is allowed to create meta objects. */
     template<typename...> friend struct internal::info_node;
+    /*! @brief A meta handle is allowed to refer to meta types. */
+    friend class handle;
+    /*! @brief A column is allowed to relocate objects of a meta type. */
+    friend class column;
+    /*! @brief A JSON reader is allowed to index meta types. */
+    friend class json_reader;
+    /*! @brief A name table is allowed to refer to meta types. */
+    friend class name_table;
 
     type(const internal::type_node *curr) noexcept
         : node{curr}
@@ -1538,12 +2173,45 @@ public:
         : node{nullptr}
     {}
 
+    /**
+     * @brief Returns the identifier assigned to a given meta type.
+     * @return The identifier assigned to the meta type, if any.
+     */
+    std::size_t identifier() const noexcept {
+        return node->identifier;
+    }
+
+    /**
+     * @brief Returns the traits of a given meta type as a set of flags.
+     * @return The traits of the underlying type.
+     */
+    type_traits traits() const noexcept {
+        return node->traits;
+    }
+
+    /**
+     * @brief Checks whether a given meta type has any of the given traits.
+     *
+     * Multiple traits can be tested at once, as an example:
+     *
+     * @code{.cpp}
+     * type.is(meta::type_traits::is_integral | meta::type_traits::is_enum);
+     * @endcode
+     *
+     * @param mask A set of traits.
+     * @return True if the underlying type has at least one of the traits,
+     * false otherwise.
+     */
+    bool is(const type_traits mask) const noexcept {
+        return (node->traits & mask) != type_traits::none;
+    }
+
     /**
      * @brief Indicates whether a given meta type refers to void or not.
      * @return True if the underlying type is void, false otherwise.
      */
     bool is_void() const noexcept {
-        return node->is_void;
+        return is(type_traits::is_void);
     }
 
     /**
@@ -1552,7 +2220,7 @@ public:
      * @return True if the underlying type is an integral type, false otherwise.
      */
     bool is_integral() const noexcept {
-        return node->is_integral;
+        return is(type_traits::is_integral);
     }
 
     /**
@@ -1562,7 +2230,7 @@ public:
      * otherwise.
      */
     bool is_floating_point() const noexcept {
-        return node->is_floating_point;
+        return is(type_traits::is_floating_point);
     }
 
     /**
@@ -1571,7 +2239,7 @@ public:
      * @return True if the underlying type is an array type, false otherwise.
      */
     bool is_array() const noexcept {
-        return node->is_array;
+        return is(type_traits::is_array);
     }
 
     /**
@@ -1579,7 +2247,7 @@ public:
      * @return True if the underlying type is an enum, false otherwise.
      */
     bool is_enum() const noexcept {
-        return node->is_enum;
+        return is(type_traits::is_enum);
     }
 
     /**
@@ -1587,7 +2255,7 @@ public:
      * @return True if the underlying type is an union, false otherwise.
      */
     bool is_union() const noexcept {
-        return node->is_union;
+        return is(type_traits::is_union);
     }
 
     /**
@@ -1595,7 +2263,7 @@ public:
      * @return True if the underlying type is a class, false otherwise.
      */
     bool is_class() const noexcept {
-        return node->is_class;
+        return is(type_traits::is_class);
     }
 
     /**
@@ -1603,7 +2271,7 @@ public:
      * @return True if the underlying type is a pointer, false otherwise.
      */
     bool is_pointer() const noexcept {
-        return node->is_pointer;
+        return is(type_traits::is_pointer);
     }
 
     /**
@@ -1613,7 +2281,7 @@ public:
      * otherwise.
      */
     bool is_function_pointer() const noexcept {
-        return node->is_function_pointer;
+        return is(type_traits::is_function_pointer);
     }
 
     /**
@@ -1623,7 +2291,7 @@ public:
      * otherwise.
      */
     bool is_member_object_pointer() const noexcept {
-        return node->is_member_object_pointer;
+        return is(type_traits::is_member_object_pointer);
     }
 
     /**
@@ -1633,7 +2301,7 @@ public:
      * false otherwise.
      */
     bool is_member_function_pointer() const noexcept {
-        return node->is_member_function_pointer;
+        return is(type_traits::is_member_function_pointer);
     }
 
     /**
@@ -1643,7 +2311,62 @@ public:
      * array type, 0 otherwise.
      */
     size_type extent() const noexcept {
-        return node->extent;
+        return node->ops->extent;
+    }
+
+    /**
+     * @brief Indicates whether a given meta type refers to a trivially
+     * copyable type or not.
+     *
+     * Instances of trivially copyable types can be copied and relocated with
+     * a plain memory copy.
+     *
+     * @return True if the underlying type is trivially copyable, false
+     * otherwise.
+     */
+    bool is_trivially_copyable() const noexcept {
+        return is(type_traits::is_trivially_copyable);
+    }
+
+    /**
+     * @brief Indicates whether a given meta type refers to a trivially
+     * destructible type or not.
+     *
+     * Destroying instances of trivially destructible types is a no-op.
+     *
+     * @return True if the underlying type is trivially destructible, false
+     * otherwise.
+     */
+    bool is_trivially_destructible() const noexcept {
+        return is(type_traits::is_trivially_destructible);
+    }
+
+    /**
+     * @brief Indicates whether a given meta type refers to a default
+     * constructible type or not.
+     * @return True if the underlying type is default constructible, false
+     * otherwise.
+     */
+    bool is_default_constructible() const noexcept {
+        return is(type_traits::is_default_constructible);
+    }
+
+    /**
+     * @brief Returns the size of the underlying type, if known.
+     * @return The size in bytes of the underlying type, 0 for void and
+     * function types.
+     */
+    size_type size_of() const noexcept {
+        return node->ops->size_of;
+    }
+
+    /**
+     * @brief Returns the alignment of the underlying type, if known.
+     * @return The alignment in bytes of the underlying type, 0 for void and
+     * function types.
+     */
+    size_type align_of() const noexcept {
+        return node->ops->align_of;
     }
 
     /**
@@ -1652,7 +2375,16 @@ public:
      * if it doesn't refer to a pointer type.
      */
     meta::type remove_pointer() const noexcept {
-        return node->remove_pointer();
+        return node->ops->remove_pointer();
+    }
+
+    /**
+     * @brief Provides the meta type of the elements of an array.
+     * @return The meta type of the elements of the array or this meta type if
+     * it doesn't refer to an array type.
+     */
+    meta::type remove_extent() const noexcept {
+        return node->ops->remove_extent();
     }
 
     /**
@@ -1741,7 +2473,7 @@ public:
      */
     template<typename... Args>
     meta::ctor ctor() const noexcept {
-        const auto *curr = internal::ctor<Args...>(std::make_index_sequence<sizeof...(Args)>{}, node);
+        const auto *curr = internal::ctor<Args...>(node);
         return curr ? curr->clazz() : meta::ctor{};
     }
 
@@ -1811,7 +2543,9 @@ public:
      *
      * Searches recursively among **all** the meta functions of the given type.
      * This means that the meta functions of the base classes will also be
-     * inspected, if any.
+     * inspected, if any.<br/>
+     * In case of overloaded functions, the first overload registered is
+     * returned.
      *
      * @param identifier Unique identifier.
      * @return The meta function associated with the given identifier, if any.
@@ -1824,12 +2558,68 @@ public:
         return curr ? curr->clazz() : meta::func{};
     }
 
+    /**
+     * @brief Invokes the meta function associated with a given identifier that
+     * best fits the given arguments, if any.
+     *
+     * Meta functions can be overloaded, that is, more than one of them can be
+     * registered under the same identifier. The one whose arguments match
+     * exactly the types of the parameters is preferred. Otherwise, the one
+     * that requires the cheapest casts and conversions is used, if any.<br/>
+     * As it happens in C++, the overloads of the first type in the hierarchy
+     * that has any hide those of its base classes with the same identifier.
+     * <br/>
+     * The decision is cached per identifier and list of types of the
+     * parameters, thus repeated calls don't pay the cost of the lookup.
+     *
+     * @tparam Args Types of arguments to use to invoke the function.
+     * @param identifier Unique identifier.
+     * @param handle An opaque pointer to an instance of the underlying type.
+     * @param args Parameters to use to invoke the function.
+     * @return A meta any containing the returned value, if any.
+     */
+    template<typename... Args>
+    any invoke(const std::size_t identifier, handle handle, Args &&... args) const {
+        static thread_local internal::dispatch_cache<internal::func_node, sizeof...(Args)> cache{};
+        // makes aliasing on the values and passes forward references if any
+        std::array<any, sizeof...(Args)> arguments{{meta::handle{args}...}};
+        std::array<const internal::type_node *, sizeof...(Args)> types{};
+        any any{};
+
+        for(std::size_t pos{}; pos < arguments.size(); ++pos) {
+            types[pos] = arguments[pos].node;
+        }
+
+        if(cache.owner != node || cache.identifier != identifier || cache.generation != internal::type_info<>::generation || cache.args != types) {
+            cache.node = internal::overload(node, identifier, types.data(), types.size());
+            cache.generation = internal::type_info<>::generation;
+            cache.identifier = identifier;
+            cache.owner = node;
+            cache.args = types;
+        }
+
+        if(cache.node) {
+            internal::trace_scope trace{trace_event::invoke, cache.node, cache.node->parent, cache.node->identifier};
+            internal::counter_scope count{*cache.node};
+            any = cache.node->invoke(*cache.node, handle, arguments.data());
+            trace(static_cast<bool>(any));
+            count(static_cast<bool>(any));
+        }
+
+        return any;
+    }
+
     /**
      * @brief Creates an instance of the underlying type, if possible.
      *
-     * To create a valid instance, the types of the parameters must coincide
-     * exactly with those required by the underlying meta constructor.
-     * Otherwise, an empty and then invalid container is returned.
+     * The meta constructor whose arguments match exactly the types of the
+     * parameters is preferred. Otherwise, the one that requires the cheapest
+     * casts and conversions is used, if any.<br/>
+     * The meta constructors of the base classes are searched only when none of
+     * those of the type fits the parameters. In this case, the instance has
+     * the type of the base class.<br/>
+     * The decision is cached per list of types of the parameters, thus
+     * repeated calls don't pay the cost of the lookup.
      *
      * @tparam Args Types of arguments to use to construct the instance.
      * @param args Parameters to use to construct the instance.
@@ -1837,20 +2627,40 @@ public:
      */
     template<typename... Args>
     any construct(Args &&... args) const {
+        internal::trace_scope trace{trace_event::construct, node, node, node->identifier};
         std::array<any, sizeof...(Args)> arguments{{std::forward<Args>(args)...}};
-        any any{};
-
-        internal::find_if<&internal::type_node::ctor>([data = arguments.data(), &any](auto *curr) -> bool {
-            if(curr->size == sizeof...(args)) {
-                any = curr->invoke(data);
-            }
-
-            return static_cast<bool>(any);
-        }, node);
-
+        const auto *curr = overload<true, Args...>(arguments);
+        auto any = curr ? curr->invoke(arguments.data()) : meta::any{};
+        trace(static_cast<bool>(any));
         return any;
     }
 
+    /**
+     * @brief Creates an instance of the underlying type directly into the
+     * given storage, if possible.
+     *
+     * The storage must be suitably sized and aligned for the underlying type
+     * and it doesn't have to contain a live object. Callers are responsible
+     * for the lifetime of the instance, if any is created.<br/>
+     * The meta constructor is selected as in the case of the construct member
+     * function, except for the fact that only those of the type are used.
+     * Instances of base classes cannot stand in for the underlying type.
+     *
+     * @tparam Args Types of arguments to use to construct the instance.
+     * @param storage A pointer to the storage to use for the new instance.
+     * @param args Parameters to use to construct the instance.
+     * @return True in case of success, false otherwise.
+     */
+    template<typename... Args>
+    bool construct_at(void *storage, Args &&... args) const {
+        internal::trace_scope trace{trace_event::construct, node, node, node->identifier};
+        std::array<any, sizeof...(Args)> arguments{{std::forward<Args>(args)...}};
+        const auto *curr = overload<false, Args...>(arguments);
+        const bool done = curr && curr->construct(storage, arguments.data());
+        trace(done);
+        return done;
+    }
+
     /**
      * @brief Destroys an instance of the underlying type.
      *
@@ -1864,7 +2674,35 @@ public:
      * @return True in case of success, false otherwise.
      */
     bool destroy(handle handle) const {
-        return (handle.type() == node->clazz()) && (!node->dtor || node->dtor->invoke(handle));
+        return (handle.type() == node->ops->clazz()) && (!node->dtor || node->dtor->invoke(handle));
+    }
+
+    /**
+     * @brief Destroys the object of the underlying type at a given address.
+     *
+     * The meta destructor is invoked first, if any. The actual destructor of
+     * the underlying type is then invoked on the object. The storage isn't
+     * released and can be reused.<br/>
+     * The instance must be an object of the underlying type, as the one
+     * created by a call to construct_at. Otherwise, invoking this function
+     * results in an undefined behavior.
+     *
+     * @param instance An opaque pointer to an object of the underlying type.
+     * @return True in case of success, false if the underlying type cannot be
+     * destroyed.
+     */
+    bool destroy_at(void *instance) const {
+        const bool destroyable = node->ops->destroy_at;
+
+        if(destroyable) {
+            if(node->dtor) {
+                node->dtor->invoke(meta::handle{*this, instance});
+            }
+
+            node->ops->destroy_at(instance);
+        }
+
+        return destroyable;
     }
 
     /**
@@ -1924,6 +2762,36 @@ public:
     }
 
 private:
+    template<bool Bases, typename... Args>
+    const internal::ctor_node * overload(const std::array<any, sizeof...(Args)> &arguments) const noexcept {
+        static thread_local internal::dispatch_cache<internal::ctor_node, sizeof...(Args)> cache{};
+        std::array<const internal::type_node *, sizeof...(Args)> types{};
+
+        for(std::size_t pos{}; pos < arguments.size(); ++pos) {
+            types[pos] = arguments[pos].node;
+        }
+
+        if(cache.owner != node || cache.generation != internal::type_info<>::generation || cache.args != types) {
+            std::size_t signature{};
+
+            for(auto *curr: types) {
+                signature = internal::signature(signature, curr);
+            }
+
+            if constexpr(Bases) {
+                cache.node = internal::match_ctor([](auto *) { return true; }, node, signature, types.data(), types.size());
+            } else {
+                cache.node = internal::match([](auto *) { return true; }, node->ctor, signature, types.data(), types.size());
+            }
+
+            cache.generation = internal::type_info<>::generation;
+            cache.owner = node;
+            cache.args = types;
+        }
+
+        return cache.node;
+    }
+
     const internal::type_node *node;
 };
 
@@ -1939,6 +2807,187 @@ inline bool operator!=(const type &lhs, const type &rhs) noexcept {
 }
 
 
+#ifdef META_TRACE
+/**
+ * @brief Event reported to the tracing hook.
+ *
+ * The node is an opaque pointer that identifies the meta function, the meta
+ * data or the meta type involved. For conversions and casts, it's that of the
+ * meta type of the instance.
+ */
+struct trace_record {
+    /*! @brief What happened. */
+    trace_event event;
+    /*! @brief Opaque pointer to the node involved, if any. */
+    const void *node;
+    /**
+     * @brief Parent of the meta function or the meta data, constructed meta
+     * type or type requested by a conversion or a cast.
+     */
+    meta::type type;
+    /*! @brief Identifier of the meta function or the meta data, if any. */
+    std::size_t identifier;
+    /*! @brief True in case of success, false otherwise. */
+    bool success;
+    /**
+     * @brief Time spent between the beginning and the end of the event.
+     *
+     * Casts aren't timed and their records always have a null duration.
+     */
+    std::chrono::nanoseconds duration;
+};
+
+
+/**
+ * @brief Sets the function to invoke when tracing events.
+ *
+ * Tracing is available only when `META_TRACE` is defined. It must be defined
+ * consistently across all the translation units.<br/>
+ * Events are reported around invocations of meta functions, reads and writes
+ * of meta data, constructions and conversions. Casts are reported only when
+ * they fail. Events that start before setting a hook aren't reported.
+ *
+ * @warning
+ * Hooks are invoked from destructors and noexcept functions, therefore they
+ * must not throw. An exception that escapes a hook terminates the program.
+ *
+ * @param hook A function to invoke when tracing events, if any.
+ * @return The function previously set, if any.
+ */
+inline trace_hook * trace(trace_hook *hook) noexcept {
+    return std::exchange(internal::type_info<>::tracer, hook);
+}
+#endif
+
+
+/**
+ * @brief Call site object.
+ *
+ * A call site is an inline cache for the invocation of meta functions through
+ * their identifiers. It keeps track of the last receivers and types of
+ * arguments it has seen along with the meta functions they resolve to.<br/>
+ * Once warmed up, invoking a function costs a lookup in a handful of entries
+ * and a direct call to the function, while the overload resolution and the
+ * search through the base classes are performed only on misses.
+ *
+ * Call sites aren't thread safe. Users should create one per thread, usually
+ * one for each place in their code from which a given function is invoked.
+ */
+class call_site {
+    struct entry;
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Number of receivers and arguments remembered by a call site. */
+    static constexpr size_type capacity = 4u;
+
+    /*! @brief Maximum number of arguments of the invocations cached. */
+    static constexpr size_type arity = 6u;
+
+    /**
+     * @brief Constructs a call site for a given identifier.
+     * @param identifier Unique identifier of the functions to invoke.
+     */
+    explicit call_site(const std::size_t identifier) noexcept
+        : entries{},
+          generation{internal::type_info<>::generation},
+          last{},
+          id{identifier}
+    {}
+
+    /**
+     * @brief Returns the identifier of the functions invoked by a call site.
+     * @return The identifier of the functions invoked by the call site.
+     */
+    std::size_t identifier() const noexcept {
+        return id;
+    }
+
+    /**
+     * @brief Invokes the meta function that best fits the given receiver and
+     * arguments, if any.
+     *
+     * The meta function is searched in the meta type of the receiver and in
+     * its base classes. In case of overloaded functions, the rules are the
+     * same of meta::type::invoke.<br/>
+     * Invocations with more arguments than those cached by a call site always
+     * look up the function.
+     *
+     * @tparam Args Types of arguments to use to invoke the function.
+     * @param handle An opaque pointer to the receiver of the invocation.
+     * @param args Parameters to use to invoke the function.
+     * @return A meta any containing the returned value, if any.
+     */
+    template<typename... Args>
+    any invoke(handle handle, Args &&... args) {
+        // makes aliasing on the values and passes forward references if any
+        std::array<any, sizeof...(Args)> arguments{{meta::handle{args}...}};
+        std::array<const internal::type_node *, sizeof...(Args)> types{};
+        const internal::func_node *node = nullptr;
+        any any{};
+
+        for(std::size_t pos{}; pos < arguments.size(); ++pos) {
+            types[pos] = arguments[pos].node;
+        }
+
+        if constexpr(sizeof...(Args) <= arity) {
+            if(generation != internal::type_info<>::generation) {
+                generation = internal::type_info<>::generation;
+                entries = {};
+            }
+
+            auto *curr = entries.data();
+
+            // the whole signature is compared, hashes of different types may collide
+            while(curr != entries.data() + capacity && (curr->type != handle.node || curr->size != types.size() || !std::equal(types.cbegin(), types.cend(), curr->args.cbegin()))) {
+                ++curr;
+            }
+
+            if(curr == entries.data() + capacity) {
+                curr = entries.data() + (last++ % capacity);
+                *curr = { handle.node, types.size(), {}, internal::overload(handle.node, id, types.data(), types.size()) };
+                std::copy(types.cbegin(), types.cend(), curr->args.begin());
+            }
+
+            node = curr->node;
+        } else {
+            node = internal::overload(handle.node, id, types.data(), types.size());
+        }
+
+        if(node) {
+            internal::trace_scope trace{trace_event::invoke, node, node->parent, node->identifier};
+            internal::counter_scope count{*node};
+            any = node->invoke(*node, handle, arguments.data());
+            trace(static_cast<bool>(any));
+            count(static_cast<bool>(any));
+        }
+
+        return any;
+    }
+
+private:
+    struct entry {
+        const internal::type_node *type;
+        size_type size;
+        std::array<const internal::type_node *, arity> args;
+        const internal::func_node *node;
+    };
+
+    std::array<entry, capacity> entries;
+    std::size_t generation;
+    size_type last;
+    std::size_t id;
+};
+
+
+inline handle::handle(const meta::type &type, void *obj) noexcept
+    : node{type.node},
+      instance{obj}
+{}
+
+
 inline any::any(handle handle) noexcept
     : any{}
 {
@@ -1948,72 +2997,72 @@ inline any::any(handle handle) noexcept
 
 
 inline meta::type any::type() const noexcept {
-    return node ? node->clazz() : meta::type{};
+    return node ? node->ops->clazz() : meta::type{};
 }
 
 
 inline meta::type handle::type() const noexcept {
-    return node ? node->clazz() : meta::type{};
+    return node ? node->ops->clazz() : meta::type{};
 }
 
 
 inline meta::type base::parent() const noexcept {
-    return node->parent->clazz();
+    return node->parent->ops->clazz();
 }
 
 
 inline meta::type base::type() const noexcept {
-    return node->ref()->clazz();
+    return node->ref()->ops->clazz();
 }
 
 
 inline meta::type conv::parent() const noexcept {
-    return node->parent->clazz();
+    return node->parent->ops->clazz();
 }
 
 
 inline meta::type conv::type() const noexcept {
-    return node->ref()->clazz();
+    return node->ref()->ops->clazz();
 }
 
 
 inline meta::type ctor::parent() const noexcept {
-    return node->parent->clazz();
+    return node->parent->ops->clazz();
 }
 
 
 inline meta::type ctor::arg(size_type index) const noexcept {
-    return index < size() ? node->arg(index)->clazz() : meta::type{};
+    return index < size() ? node->arg(index)->ops->clazz() : meta::type{};
 }
 
 
 inline meta::type dtor::parent() const noexcept {
-    return node->parent->clazz();
+    return node->parent->ops->clazz();
 }
 
 
 inline meta::type data::parent() const noexcept {
-    return node->parent->clazz();
+    return node->parent->ops->clazz();
 }
 
 
 inline meta::type data::type() const noexcept {
-    return node->ref()->clazz();
+    return node->ref()->ops->clazz();
 }
 
 
 inline meta::type func::parent() const noexcept {
-    return node->parent->clazz();
+    return node->parent->ops->clazz();
 }
 
 
 inline meta::type func::ret() const noexcept {
-    return node->ret()->clazz();
+    return node->ret()->ops->clazz();
 }
 
 
 inline meta::type func::arg(size_type index) const noexcept {
-    return index < size() ? node->arg(index)->clazz() : meta::type{};
+    return index < size() ? node->arg(index)->ops->clazz() : meta::type{};
 }
 
 
@@ -2038,35 +3087,177 @@ static bool compare(char, const void *lhs, const void *rhs) {
 }
 
 
+template<typename Type>
+constexpr auto destroy_at() noexcept -> void(*)(void *) {
+    if constexpr(std::is_void_v<Type> || std::is_function_v<Type> || !std::is_destructible_v<Type>) {
+        return nullptr;
+    } else {
+        return [](void *instance) {
+            if constexpr(std::is_array_v<Type>) {
+                std::destroy(std::begin(*static_cast<Type *>(instance)), std::end(*static_cast<Type *>(instance)));
+            } else {
+                std::destroy_at(static_cast<Type *>(instance));
+            }
+        };
+    }
+}
+
+
+template<typename Type>
+constexpr auto copy_at() noexcept -> void(*)(void *, const void *) {
+    if constexpr(std::is_void_v<Type> || std::is_function_v<Type> || !std::is_copy_constructible_v<Type>) {
+        return nullptr;
+    } else {
+        return [](void *storage, const void *instance) {
+            new (storage) Type(*static_cast<const Type *>(instance));
+        };
+    }
+}
+
+
+template<typename Type>
+constexpr auto move_at() noexcept -> void(*)(void *, void *) {
+    if constexpr(std::is_void_v<Type> || std::is_function_v<Type> || !std::is_move_constructible_v<Type>) {
+        return nullptr;
+    } else {
+        return [](void *storage, void *instance) {
+            new (storage) Type(std::move_if_noexcept(*static_cast<Type *>(instance)));
+        };
+    }
+}
+
+
+template<typename Type>
+constexpr auto clone() noexcept -> any(*)(const void *) {
+    if constexpr(std::is_void_v<Type> || std::is_function_v<Type> || std::is_array_v<Type> || std::is_abstract_v<Type> || !std::is_copy_constructible_v<Type>) {
+        return nullptr;
+    } else {
+        return [](const void *instance) {
+            return any{std::in_place_type<Type>, *static_cast<const Type *>(instance)};
+        };
+    }
+}
+
+
+template<typename Type>
+constexpr std::size_t size_of() noexcept {
+    if constexpr(std::is_void_v<Type> || std::is_function_v<Type>) {
+        return 0u;
+    } else {
+        return sizeof(Type);
+    }
+}
+
+
+template<typename Type>
+constexpr std::size_t align_of() noexcept {
+    if constexpr(std::is_void_v<Type> || std::is_function_v<Type>) {
+        return 0u;
+    } else {
+        return alignof(Type);
+    }
+}
+
+
+template<typename Type>
+constexpr type_traits traits() noexcept {
+    const bool traits[]{
+        std::is_void_v<Type>,
+        std::is_integral_v<Type>,
+        std::is_floating_point_v<Type>,
+        std::is_array_v<Type>,
+        std::is_enum_v<Type>,
+        std::is_union_v<Type>,
+        std::is_class_v<Type>,
+        std::is_pointer_v<Type>,
+        std::is_pointer_v<Type> && std::is_function_v<std::remove_pointer_t<Type>>,
+        std::is_member_object_pointer_v<Type>,
+        std::is_member_function_pointer_v<Type>,
+        std::is_trivially_copyable_v<Type>,
+        std::is_trivially_destructible_v<Type>,
+        std::is_default_constructible_v<Type>
+    };
+
+    auto value = type_traits::none;
+
+    for(std::size_t pos{}; pos < std::size(traits); ++pos) {
+        value = value | (traits[pos] ? type_traits(1u << pos) : type_traits::none);
+    }
+
+    return value;
+}
+
+
+#ifdef META_TRACE
+inline trace_scope::~trace_scope() {
+    if(hook) {
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start);
+        hook(trace_record{event, node, type ? type->ops->clazz() : meta::type{}, identifier, success, duration});
+    }
+}
+
+
+inline void trace_scope::failure(const trace_event which, const void *curr, const type_node *target) noexcept {
+    if(auto *hook = type_info<>::tracer; hook) {
+        hook(trace_record{which, curr, target ? target->ops->clazz() : meta::type{}, {}, false, {}});
+    }
+}
+#endif
+
+
+template<typename Type>
+const type_ops info_node<Type>::ops{
+    std::extent_v<Type>,
+    size_of<Type>(),
+    align_of<Type>(),
+    [](const void *lhs, const void *rhs) {
+        return compare<Type>(0, lhs, rhs);
+    },
+    destroy_at<Type>(),
+    copy_at<Type>(),
+    move_at<Type>(),
+    clone<Type>(),
+    []() noexcept -> meta::type {
+        return internal::type_info<std::remove_pointer_t<Type>>::resolve();
+    },
+    []() noexcept -> meta::type {
+        return internal::type_info<std::remove_extent_t<Type>>::resolve();
+    },
+    []() noexcept -> meta::type {
+        // no side effects, the node is returned as is also once unregistered
+        return &node;
+    }
+};
+
+
+template<typename Type>
+type_node info_node<Type>::node{
+    {},
+    nullptr,
+    nullptr,
+    traits<Type>(),
+    &ops
+};
+
+
 template<typename Type>
 inline type_node * info_node<Type>::resolve() noexcept {
     if(!type) {
-        static type_node node{
-            {},
-            nullptr,
-            nullptr,
-            std::is_void_v<Type>,
-            std::is_integral_v<Type>,
-            std::is_floating_point_v<Type>,
-            std::is_array_v<Type>,
-            std::is_enum_v<Type>,
-            std::is_union_v<Type>,
-            std::is_class_v<Type>,
-            std::is_pointer_v<Type>,
-            std::is_pointer_v<Type> && std::is_function_v<std::remove_pointer_t<Type>>,
-            std::is_member_object_pointer_v<Type>,
-            std::is_member_function_pointer_v<Type>,
-            std::extent_v<Type>,
-            [](const void *lhs, const void *rhs) {
-                return compare<Type>(0, lhs, rhs);
-            },
-            []() noexcept -> meta::type {
-                return internal::type_info<std::remove_pointer_t<Type>>::resolve();
-            },
-            []() noexcept -> meta::type {
-                return &node;
+        // META_COUNTERS and META_TRACE change the layout of the nodes
+        assert(consistent_configuration());
+
+        if(auto *pending = std::exchange(deferred, nullptr); pending) {
+            auto **curr = &info_node<>::deferred;
+
+            while(*curr != pending) {
+                curr = &(*curr)->next;
             }
-        };
+
+            *curr = pending->next;
+            pending->next = nullptr;
+            // registration happens the first time the type is needed
+            pending->thunk();
+        }
 
         type = &node;
     }
@@ -0,0 +1,211 @@
+#ifndef META_NAME_TABLE_HPP
+#define META_NAME_TABLE_HPP
+
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+#include "hashed_string.hpp"
+#include "meta.hpp"
+
+
+namespace meta {
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+struct named_identifier {
+    // non-explicit constructors on purpose
+    constexpr named_identifier(const std::size_t identifier) noexcept
+        : value{identifier}, name{}
+    {}
+
+    constexpr named_identifier(const hashed_string &identifier) noexcept
+        : value{identifier.value()}, name{identifier.data(), identifier.size()}
+    {}
+
+    std::size_t value;
+    std::string_view name;
+};
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+/**
+ * @brief Opt-in table of the names behind identifiers.
+ *
+ * Once attached, a name table records the identifiers assigned to meta types,
+ * meta data and meta functions as they are registered, along with the
+ * strings they come from when hashed strings are used as identifiers.<br/>
+ * Duplicates and collisions between different names that result in the same
+ * identifier are detected in constant time at registration. They trigger an
+ * assertion in debug mode and are counted in any case. The names can be
+ * looked up later on for diagnostic purposes.
+ *
+ * At most one table is attached at a time. While a table is attached, it
+ * replaces the linear search through the registered identifiers that runs
+ * otherwise in debug mode. Therefore, identifiers registered before it was
+ * attached aren't checked against.<br/>
+ * Overloads of a meta function are accepted only if all of them are named
+ * after the same hashed string. Plain identifiers can't tell an overload from
+ * a collision and are rejected when they are used more than once.
+ */
+class name_table {
+    /*! @brief A meta factory is allowed to record identifiers. */
+    template<typename> friend class factory;
+
+    struct key_type {
+        const void *scope;
+        std::size_t identifier;
+
+        bool operator==(const key_type &other) const noexcept {
+            return scope == other.scope && identifier == other.identifier;
+        }
+    };
+
+    struct key_hash {
+        std::size_t operator()(const key_type &key) const noexcept {
+            const auto seed = std::hash<const void *>{}(key.scope);
+            return key.identifier ^ (seed + 0x9e3779b9 + (key.identifier << 6) + (key.identifier >> 2));
+        }
+    };
+
+    static const void * types_scope() noexcept {
+        return &internal::type_info<>::type;
+    }
+
+    static const void * data_scope(const internal::type_node *node) noexcept {
+        return &node->data;
+    }
+
+    static const void * func_scope(const internal::type_node *node) noexcept {
+        return &node->func;
+    }
+
+    bool insert(const void *scope, const internal::named_identifier &identifier, const bool shared) {
+        const auto name = identifier.name;
+        const auto [it, inserted] = names.try_emplace(key_type{scope, identifier.value}, name);
+        // overloads share their identifier, as long as both sides are named and share their name
+        const bool unique = inserted || (shared && !name.empty() && !it->second.empty() && it->second == name);
+        collisions += !unique;
+        return unique;
+    }
+
+    void erase(const void *scope, const std::size_t identifier) {
+        names.erase(key_type{scope, identifier});
+    }
+
+    std::string_view find(const void *scope, const std::size_t identifier) const {
+        const auto it = names.find(key_type{scope, identifier});
+        return it == names.cend() ? std::string_view{} : std::string_view{it->second};
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    name_table()
+        : names{},
+          collisions{}
+    {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    name_table(const name_table &) = delete;
+
+    /*! @brief Detaches the table, if required. */
+    ~name_table() {
+        detach();
+    }
+
+    /*! @brief Default copy assignment operator, deleted on purpose. */
+    name_table & operator=(const name_table &) = delete;
+
+    /**
+     * @brief Makes a table record all the identifiers registered from now on.
+     *
+     * Any other table is detached.
+     */
+    void attach() noexcept {
+        internal::type_info<>::names = this;
+    }
+
+    /*! @brief Stops recording identifiers, if the table is attached. */
+    void detach() noexcept {
+        if(internal::type_info<>::names == this) {
+            internal::type_info<>::names = nullptr;
+        }
+    }
+
+    /**
+     * @brief Returns the number of identifiers in a table.
+     * @return Number of identifiers recorded so far.
+     */
+    size_type size() const noexcept {
+        return names.size();
+    }
+
+    /**
+     * @brief Returns the number of duplicates or collisions detected so far.
+     * @return Number of rejected identifiers.
+     */
+    size_type rejected() const noexcept {
+        return collisions;
+    }
+
+    /**
+     * @brief Returns the name behind the identifier of a meta type.
+     * @param identifier Identifier of the meta type.
+     * @return The name of the meta type, empty if unknown.
+     */
+    std::string_view type(const std::size_t identifier) const {
+        return find(types_scope(), identifier);
+    }
+
+    /**
+     * @brief Returns the name behind the identifier of a meta data.
+     * @param type The meta type to which the meta data belongs.
+     * @param identifier Identifier of the meta data.
+     * @return The name of the meta data, empty if unknown.
+     */
+    std::string_view data(const meta::type &type, const std::size_t identifier) const {
+        return type ? find(data_scope(type.node), identifier) : std::string_view{};
+    }
+
+    /**
+     * @brief Returns the name behind the identifier of a meta function.
+     * @param type The meta type to which the meta function belongs.
+     * @param identifier Identifier of the meta function.
+     * @return The name of the meta function, empty if unknown.
+     */
+    std::string_view func(const meta::type &type, const std::size_t identifier) const {
+        return type ? find(func_scope(type.node), identifier) : std::string_view{};
+    }
+
+private:
+    std::unordered_map<key_type, std::string, key_hash> names;
+    size_type collisions;
+};
+
+
+}
+
+
+#endif // META_NAME_TABLE_HPP
@@ -21,6 +21,10 @@ struct as_is_t {};
 struct as_void_t {};
 
 
+/*! @brief Empty class type used to request the _as strict_ policy. */
+struct as_strict_t {};
+
+
 }
 
 
@@ -0,0 +1,272 @@
+#ifndef META_POOL_HPP
+#define META_POOL_HPP
+
+
+#include <new>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include "meta.hpp"
+
+
+namespace meta {
+
+
+/**
+ * @brief Object pool for a reflected type.
+ *
+ * An object pool hands out slots of memory sized and aligned for the given
+ * meta type and creates objects into them by means of the registered meta
+ * constructors. Objects are destroyed by means of the registered meta
+ * destructor, if any, and the actual destructor of the type.<br/>
+ * Memory is allocated in fixed size chunks and is never returned to the system
+ * until the pool is destroyed. Therefore, creating and destroying objects over
+ * and over doesn't result in allocations once the pool has grown enough.
+ *
+ * Objects that are still alive when a pool is destroyed are destroyed along
+ * with it.
+ */
+class object_pool {
+    static constexpr std::size_t default_chunk_size = 64u;
+
+    static std::size_t alignment_of(const type &type) noexcept {
+        return std::max(type.align_of(), alignof(void *));
+    }
+
+    static std::size_t stride_of(const type &type) noexcept {
+        const auto alignment = alignment_of(type);
+        return ((std::max(type.size_of(), sizeof(void *)) + alignment - 1u) / alignment) * alignment;
+    }
+
+    void * next(void *slot) const noexcept {
+        void *curr;
+        std::memcpy(&curr, slot, sizeof(void *));
+        return curr;
+    }
+
+    void release(void *slot) noexcept {
+        std::memcpy(slot, &free, sizeof(void *));
+        free = slot;
+    }
+
+    std::size_t bitmap_offset() const noexcept {
+        return chunk_size * stride;
+    }
+
+    std::size_t bitmap_size() const noexcept {
+        return (chunk_size + 7u) / 8u;
+    }
+
+    void grow() {
+        // reserve first, pushing back the chunk cannot throw and leak it then
+        chunks.reserve(chunks.size() + 1u);
+        // the trailing bitmap is used only to find live objects on destruction
+        auto *chunk = static_cast<std::byte *>(::operator new(bitmap_offset() + bitmap_size(), std::align_val_t{alignment}));
+        chunks.push_back(chunk);
+
+        for(auto pos = chunk_size; pos; --pos) {
+            release(chunk + (pos - 1u) * stride);
+        }
+    }
+
+    void destroy_all() {
+        if(!owner.is_trivially_destructible() || owner.dtor()) {
+            // chunks are about to be freed, sorting them in place is fine
+            std::sort(chunks.begin(), chunks.end(), std::less<std::byte *>{});
+
+            for(auto *chunk: chunks) {
+                std::memset(chunk + bitmap_offset(), 0, bitmap_size());
+            }
+
+            for(auto *curr = free; curr; curr = next(curr)) {
+                auto *slot = static_cast<std::byte *>(curr);
+                auto *chunk = *(std::upper_bound(chunks.cbegin(), chunks.cend(), slot, std::less<std::byte *>{}) - 1);
+                const auto pos = std::size_t(slot - chunk) / stride;
+                chunk[bitmap_offset() + pos / 8u] |= std::byte{1u} << (pos % 8u);
+            }
+
+            for(auto *chunk: chunks) {
+                for(std::size_t pos{}; pos < chunk_size; ++pos) {
+                    if((chunk[bitmap_offset() + pos / 8u] & (std::byte{1u} << (pos % 8u))) == std::byte{}) {
+                        owner.destroy_at(chunk + pos * stride);
+                    }
+                }
+            }
+        }
+
+        for(auto *chunk: chunks) {
+            ::operator delete(chunk, std::align_val_t{alignment});
+        }
+
+        chunks.clear();
+        free = nullptr;
+        count = {};
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an object pool for a given meta type.
+     * @param type A valid meta type with a non-null size.
+     * @param size Number of objects allocated at once when the pool grows.
+     */
+    explicit object_pool(const meta::type &type, const size_type size = default_chunk_size)
+        : chunks{},
+          owner{type},
+          free{nullptr},
+          chunk_size{size},
+          stride{stride_of(type)},
+          alignment{alignment_of(type)},
+          count{}
+    {
+        assert(type && type.size_of() && size);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    object_pool(const object_pool &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    object_pool(object_pool &&other) noexcept
+        : chunks{std::move(other.chunks)},
+          owner{other.owner},
+          free{std::exchange(other.free, nullptr)},
+          chunk_size{other.chunk_size},
+          stride{other.stride},
+          alignment{other.alignment},
+          count{std::exchange(other.count, size_type{})}
+    {
+        other.chunks.clear();
+    }
+
+    /*! @brief Destroys the objects still alive and frees the memory. */
+    ~object_pool() {
+        destroy_all();
+    }
+
+    /*! @brief Default copy assignment operator, deleted on purpose. */
+    object_pool & operator=(const object_pool &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This object pool.
+     */
+    object_pool & operator=(object_pool &&other) noexcept {
+        if(this != &other) {
+            destroy_all();
+            chunks = std::move(other.chunks);
+            other.chunks.clear();
+            owner = other.owner;
+            free = std::exchange(other.free, nullptr);
+            chunk_size = other.chunk_size;
+            stride = other.stride;
+            alignment = other.alignment;
+            count = std::exchange(other.count, size_type{});
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the meta type of the objects created by a pool.
+     * @return The meta type of the objects created by the pool.
+     */
+    meta::type type() const noexcept {
+        return owner;
+    }
+
+    /**
+     * @brief Returns the number of objects alive in a pool.
+     * @return Number of objects alive in the pool.
+     */
+    size_type size() const noexcept {
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of objects a pool can contain without
+     * allocating.
+     * @return Capacity of the pool.
+     */
+    size_type capacity() const noexcept {
+        return chunks.size() * chunk_size;
+    }
+
+    /**
+     * @brief Creates a new object, if possible.
+     *
+     * The meta constructor is selected as in the case of
+     * meta::type::construct_at. Therefore, only the meta constructors of the
+     * type are used and those of its base classes are never tried.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param args Parameters to use to construct the object.
+     * @return A handle to the newly created object, an empty handle in case
+     * no suitable meta constructor exists.
+     */
+    template<typename... Args>
+    handle construct(Args &&... args) {
+        if(!free) {
+            grow();
+        }
+
+        struct guard {
+            ~guard() { if(slot) { pool->release(slot); } }
+            object_pool *pool;
+            void *slot;
+        };
+
+        // the slot returns to the free list unless an object lives in it
+        guard pending{this, free};
+        free = next(pending.slot);
+
+        if(owner.construct_at(pending.slot, std::forward<Args>(args)...)) {
+            ++count;
+            return handle{owner, std::exchange(pending.slot, nullptr)};
+        }
+
+        return handle{};
+    }
+
+    /**
+     * @brief Destroys an object and returns its slot to a pool.
+     *
+     * @warning
+     * Attempting to destroy an object that doesn't belong to the pool results
+     * in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the object doesn't have the type of the pool.
+     *
+     * @param handle A handle to an object created by the pool.
+     */
+    void destroy(handle handle) {
+        assert(handle.type() == owner);
+        owner.destroy_at(handle.data());
+        release(handle.data());
+        --count;
+    }
+
+private:
+    std::vector<std::byte *> chunks;
+    meta::type owner;
+    void *free;
+    size_type chunk_size;
+    size_type stride;
+    size_type alignment;
+    size_type count;
+};
+
+
+}
+
+
+#endif // META_POOL_HPP
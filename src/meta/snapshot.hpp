@@ -0,0 +1,536 @@
+#ifndef META_SNAPSHOT_HPP
+#define META_SNAPSHOT_HPP
+
+
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <iterator>
+#include <algorithm>
+#include "meta.hpp"
+#include "factory.hpp"
+
+
+namespace meta {
+
+
+/*! @brief Record of a meta type in a snapshot. */
+struct snapshot_type {
+    /*! @brief Identifier of the type. */
+    std::uint64_t identifier;
+    /*! @brief Size in bytes of the type. */
+    std::uint64_t size_of;
+    /*! @brief Alignment in bytes of the type. */
+    std::uint64_t align_of;
+    /*! @brief Number of elements of array types. */
+    std::uint64_t extent;
+    /*! @brief Traits of the type. */
+    type_traits traits;
+    /*! @brief Number of properties of the type. */
+    std::uint32_t props;
+    /*! @brief Number of base classes of the type. */
+    std::uint32_t bases;
+    /*! @brief Number of meta data of the type. */
+    std::uint32_t data;
+    /*! @brief Number of meta functions of the type. */
+    std::uint32_t func;
+    /*! @brief Position of the first member of the type. */
+    std::uint32_t first;
+    /*! @brief Position of the first property of the type. */
+    std::uint32_t first_prop;
+    /*! @brief Reserved for future uses, always zero. */
+    std::uint32_t reserved;
+
+    /**
+     * @brief Returns false if a record is empty, true otherwise.
+     * @return False if the record is empty, true otherwise.
+     */
+    explicit operator bool() const noexcept {
+        return identifier;
+    }
+};
+
+
+/*! @brief Record of a meta data or a meta function in a snapshot. */
+struct snapshot_member {
+    /*! @brief Offset used for members that have no known offset. */
+    static constexpr std::uint64_t npos = std::numeric_limits<std::uint64_t>::max();
+
+    /*! @brief Identifier of the member. */
+    std::uint64_t identifier;
+    /*! @brief Identifier of the type of a data or of the return type of a function. */
+    std::uint64_t type;
+    /*! @brief Offset of a data within its parent, npos if unknown or for functions. */
+    std::uint64_t offset;
+    /*! @brief Number of arguments of functions, zero for data. */
+    std::uint32_t arity;
+    /*! @brief Number of properties of the member. */
+    std::uint32_t props;
+    /*! @brief Position of the first property of the member. */
+    std::uint32_t first_prop;
+    /*! @brief True if the member is constant, false otherwise. */
+    bool is_const;
+    /*! @brief True if the member is static, false otherwise. */
+    bool is_static;
+    /*! @brief Reserved for future uses, always zero. */
+    std::uint16_t reserved;
+
+    /**
+     * @brief Returns false if a record is empty, true otherwise.
+     * @return False if the record is empty, true otherwise.
+     */
+    explicit operator bool() const noexcept {
+        return identifier;
+    }
+};
+
+
+/**
+ * @brief Record of the key of a property in a snapshot.
+ *
+ * Keys are stored by type. Integral and enum keys have their value stored
+ * along with them, zero-extended to 64 bits.
+ */
+struct snapshot_prop {
+    /*! @brief Identifier of the type of the key, zero if it has none. */
+    std::uint64_t type;
+    /*! @brief Value of integral and enum keys, zero otherwise. */
+    std::uint64_t value;
+    /*! @brief Traits of the type of the key. */
+    type_traits traits;
+    /*! @brief Reserved for future uses, always zero. */
+    std::uint32_t reserved;
+};
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+struct snapshot_header {
+    static constexpr std::uint32_t signature = 0x4154454Du;
+    static constexpr std::uint32_t revision = 2u;
+
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t types;
+    std::uint64_t members;
+    std::uint64_t props;
+};
+
+
+template<typename Op>
+std::uint32_t snapshot_count(Op op) {
+    std::uint32_t count{};
+    op([&count](auto &&...) { ++count; });
+    return count;
+}
+
+
+template<typename Int>
+std::uint64_t snapshot_bits(const void *data) noexcept {
+    Int value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+
+template<typename Owner>
+std::uint32_t snapshot_props(const Owner &owner, std::vector<snapshot_prop> &props) {
+    const auto first = props.size();
+
+    owner.prop([&props](meta::prop prop) {
+        const auto key = prop.key();
+        const auto type = key.type();
+        std::uint64_t value{};
+
+        if((type.traits() & (type_traits::is_integral | type_traits::is_enum)) != type_traits::none) {
+            switch(type.size_of()) {
+            case sizeof(std::uint8_t):
+                value = snapshot_bits<std::uint8_t>(key.data());
+                break;
+            case sizeof(std::uint16_t):
+                value = snapshot_bits<std::uint16_t>(key.data());
+                break;
+            case sizeof(std::uint32_t):
+                value = snapshot_bits<std::uint32_t>(key.data());
+                break;
+            case sizeof(std::uint64_t):
+                value = snapshot_bits<std::uint64_t>(key.data());
+                break;
+            }
+        }
+
+        props.push_back({type.identifier(), value, type.traits(), 0u});
+    });
+
+    return std::uint32_t(props.size() - first);
+}
+
+
+inline std::uint64_t snapshot_offset(const meta::data &data) noexcept {
+    const auto offset = data.offset();
+    return offset == meta::data::npos ? snapshot_member::npos : offset;
+}
+
+
+inline std::uint64_t snapshot_offset(const meta::func &) noexcept {
+    return snapshot_member::npos;
+}
+
+
+template<typename Member>
+snapshot_member snapshot_member_of(const Member &member, const meta::type &type, const std::uint32_t arity, std::vector<snapshot_prop> &props) {
+    const auto first_prop = std::uint32_t(props.size());
+
+    return {
+        member.identifier(),
+        type ? type.identifier() : 0u,
+        snapshot_offset(member),
+        arity,
+        snapshot_props(member, props),
+        first_prop,
+        member.is_const(),
+        member.is_static(),
+        0u
+    };
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+/**
+ * @brief Exports the metadata of all the reflected types.
+ *
+ * The snapshot contains a record for each type that has an identifier, sorted
+ * by identifier, followed by the records of their meta data and meta
+ * functions and by those of the keys of their properties. Offsets of the meta
+ * data are part of the records when known. Native functions, property values
+ * and objects aren't part of a snapshot.<br/>
+ * A snapshot is an export of the registry for inspection and verification,
+ * for example to compare the layout of the types between builds. It doesn't
+ * replace registration.<br/>
+ * The bytes are in the native representation of the platform and the records
+ * are suitably aligned if the snapshot is, as it happens with memory mapped
+ * files.
+ *
+ * @return The snapshot of the registry as a sequence of bytes.
+ */
+inline std::vector<std::byte> snapshot() {
+    std::vector<meta::type> types{};
+
+    resolve([&types](meta::type type) {
+        if(type.identifier()) {
+            types.push_back(type);
+        }
+    });
+
+    std::sort(types.begin(), types.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.identifier() < rhs.identifier();
+    });
+
+    std::vector<snapshot_type> records{};
+    std::vector<snapshot_member> members{};
+    std::vector<snapshot_prop> props{};
+
+    for(auto &&type: types) {
+        const auto first = members.size();
+        const auto first_prop = std::uint32_t(props.size());
+        const auto count = internal::snapshot_props(type, props);
+        std::uint32_t data{};
+        std::uint32_t func{};
+
+        type.data([&members, &props, &data](meta::data curr) {
+            members.push_back(internal::snapshot_member_of(curr, curr.type(), 0u, props));
+            ++data;
+        });
+
+        type.func([&members, &props, &func](meta::func curr) {
+            members.push_back(internal::snapshot_member_of(curr, curr.ret(), std::uint32_t(curr.size()), props));
+            ++func;
+        });
+
+        const auto by_identifier = [](const auto &lhs, const auto &rhs) { return lhs.identifier < rhs.identifier; };
+        std::stable_sort(members.begin() + first, members.begin() + first + data, by_identifier);
+        std::stable_sort(members.begin() + first + data, members.end(), by_identifier);
+
+        records.push_back({
+            type.identifier(),
+            type.size_of(),
+            type.align_of(),
+            type.extent(),
+            type.traits(),
+            count,
+            internal::snapshot_count([&type](auto op) { type.base(op); }),
+            data,
+            func,
+            std::uint32_t(first),
+            first_prop,
+            0u
+        });
+    }
+
+    const internal::snapshot_header header{internal::snapshot_header::signature, internal::snapshot_header::revision, records.size(), members.size(), props.size()};
+    const auto props_offset = sizeof(header) + records.size() * sizeof(snapshot_type) + members.size() * sizeof(snapshot_member);
+    std::vector<std::byte> buffer(props_offset + props.size() * sizeof(snapshot_prop));
+
+    std::memcpy(buffer.data(), &header, sizeof(header));
+
+    if(!records.empty()) {
+        std::memcpy(buffer.data() + sizeof(header), records.data(), records.size() * sizeof(snapshot_type));
+    }
+
+    if(!members.empty()) {
+        std::memcpy(buffer.data() + sizeof(header) + records.size() * sizeof(snapshot_type), members.data(), members.size() * sizeof(snapshot_member));
+    }
+
+    if(!props.empty()) {
+        std::memcpy(buffer.data() + props_offset, props.data(), props.size() * sizeof(snapshot_prop));
+    }
+
+    return buffer;
+}
+
+
+/**
+ * @brief Read-only view over a snapshot of the registry.
+ *
+ * A view doesn't copy the snapshot and doesn't register anything. Therefore,
+ * types, members and keys of properties can be inspected and looked up by
+ * identifier as soon as the snapshot is available, for example by memory
+ * mapping a file.<br/>
+ * Actual meta types are bound only on request, by resolving their identifiers
+ * in the registry. Only types that are registered can be bound.
+ */
+class snapshot_view {
+    template<typename Record>
+    Record record(const std::size_t offset) const noexcept {
+        Record value;
+        std::memcpy(&value, first + offset, sizeof(Record));
+        return value;
+    }
+
+    std::size_t member_offset(const std::size_t pos) const noexcept {
+        return sizeof(internal::snapshot_header) + types * sizeof(snapshot_type) + pos * sizeof(snapshot_member);
+    }
+
+    std::size_t prop_offset(const std::size_t pos) const noexcept {
+        return member_offset(members) + pos * sizeof(snapshot_prop);
+    }
+
+    bool fits(const snapshot_type &type) const noexcept {
+        // records come from outside, their ranges cannot be trusted blindly
+        return std::uint64_t{type.first} + type.data + type.func <= members;
+    }
+
+    template<typename Record>
+    snapshot_prop prop_of(const Record &owner, const std::size_t pos) const noexcept {
+        assert(pos < owner.props);
+        const bool valid = pos < owner.props && std::uint64_t{owner.first_prop} + owner.props <= props;
+        return valid ? record<snapshot_prop>(prop_offset(owner.first_prop + pos)) : snapshot_prop{};
+    }
+
+    template<typename Record, typename Func>
+    Record search(const std::size_t last, const std::uint64_t identifier, Func at) const noexcept {
+        std::size_t lo{};
+
+        for(auto hi = last; lo < hi;) {
+            const auto mid = lo + (hi - lo) / 2u;
+            at(mid).identifier < identifier ? (lo = mid + 1u) : (hi = mid);
+        }
+
+        const Record curr = lo < last ? at(lo) : Record{};
+        return curr.identifier == identifier ? curr : Record{};
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a view over a snapshot.
+     *
+     * The view is invalid if the bytes don't contain a snapshot produced by
+     * a compatible version of the library.
+     *
+     * @param data A pointer to the first byte of the snapshot.
+     * @param length Size in bytes of the snapshot.
+     */
+    snapshot_view(const std::byte *data, const size_type length) noexcept
+        : first{data},
+          types{},
+          members{},
+          props{}
+    {
+        if(internal::snapshot_header header; data && length >= sizeof(header)) {
+            std::memcpy(&header, data, sizeof(header));
+
+            if(header.magic == header.signature && header.version == header.revision
+                    && header.types <= (length - sizeof(header)) / sizeof(snapshot_type)
+                    && header.members <= (length - sizeof(header) - header.types * sizeof(snapshot_type)) / sizeof(snapshot_member)
+                    && header.props <= (length - sizeof(header) - header.types * sizeof(snapshot_type) - header.members * sizeof(snapshot_member)) / sizeof(snapshot_prop))
+            {
+                types = header.types;
+                members = header.members;
+                props = header.props;
+            } else {
+                first = nullptr;
+            }
+        } else {
+            first = nullptr;
+        }
+    }
+
+    /**
+     * @brief Returns the number of types in a snapshot.
+     * @return Number of types.
+     */
+    size_type size() const noexcept {
+        return types;
+    }
+
+    /**
+     * @brief Returns the record of the type at a given position.
+     * @param pos Position of the type, in ascending order of identifier.
+     * @return The record of the requested type.
+     */
+    snapshot_type operator[](const size_type pos) const noexcept {
+        assert(pos < types);
+        return record<snapshot_type>(sizeof(internal::snapshot_header) + pos * sizeof(snapshot_type));
+    }
+
+    /**
+     * @brief Looks up a type by identifier.
+     * @param identifier Identifier of the type to search for.
+     * @return The record of the type, if any.
+     */
+    snapshot_type find(const std::uint64_t identifier) const noexcept {
+        return search<snapshot_type>(types, identifier, [this](auto pos) { return (*this)[pos]; });
+    }
+
+    /**
+     * @brief Returns the record of the i-th meta data of a type.
+     *
+     * An empty record is returned if the members of the type don't fit the
+     * snapshot, as it happens with corrupted snapshots.
+     *
+     * @param type The record of a type.
+     * @param pos Position of the meta data, in ascending order of identifier.
+     * @return The record of the requested meta data.
+     */
+    snapshot_member data(const snapshot_type &type, const size_type pos) const noexcept {
+        assert(pos < type.data);
+        return (fits(type) && pos < type.data) ? record<snapshot_member>(member_offset(type.first + pos)) : snapshot_member{};
+    }
+
+    /**
+     * @brief Looks up a meta data of a type by identifier.
+     * @param type The record of a type.
+     * @param identifier Identifier of the meta data to search for.
+     * @return The record of the meta data, if any.
+     */
+    snapshot_member find_data(const snapshot_type &type, const std::uint64_t identifier) const noexcept {
+        return search<snapshot_member>(fits(type) ? type.data : 0u, identifier, [this, &type](auto pos) { return data(type, pos); });
+    }
+
+    /**
+     * @brief Returns the record of the i-th meta function of a type.
+     *
+     * An empty record is returned if the members of the type don't fit the
+     * snapshot, as it happens with corrupted snapshots.
+     *
+     * @param type The record of a type.
+     * @param pos Position of the meta function, in ascending order of identifier.
+     * @return The record of the requested meta function.
+     */
+    snapshot_member func(const snapshot_type &type, const size_type pos) const noexcept {
+        assert(pos < type.func);
+        return (fits(type) && pos < type.func) ? record<snapshot_member>(member_offset(type.first + type.data + pos)) : snapshot_member{};
+    }
+
+    /**
+     * @brief Looks up a meta function of a type by identifier.
+     *
+     * Overloads share their identifier. In this case, the first one is
+     * returned and the others follow it.
+     *
+     * @param type The record of a type.
+     * @param identifier Identifier of the meta function to search for.
+     * @return The record of the meta function, if any.
+     */
+    snapshot_member find_func(const snapshot_type &type, const std::uint64_t identifier) const noexcept {
+        return search<snapshot_member>(fits(type) ? type.func : 0u, identifier, [this, &type](auto pos) { return func(type, pos); });
+    }
+
+    /**
+     * @brief Returns the key of the i-th property of a type.
+     *
+     * An empty record is returned if the properties of the type don't fit the
+     * snapshot, as it happens with corrupted snapshots.
+     *
+     * @param type The record of a type.
+     * @param pos Position of the property.
+     * @return The record of the key of the requested property.
+     */
+    snapshot_prop prop(const snapshot_type &type, const size_type pos) const noexcept {
+        return prop_of(type, pos);
+    }
+
+    /**
+     * @brief Returns the key of the i-th property of a member.
+     *
+     * An empty record is returned if the properties of the member don't fit
+     * the snapshot, as it happens with corrupted snapshots.
+     *
+     * @param member The record of a meta data or a meta function.
+     * @param pos Position of the property.
+     * @return The record of the key of the requested property.
+     */
+    snapshot_prop prop(const snapshot_member &member, const size_type pos) const noexcept {
+        return prop_of(member, pos);
+    }
+
+    /**
+     * @brief Binds a type of a snapshot to the actual meta type.
+     * @param identifier Identifier of the type to bind.
+     * @return The meta type associated with the given identifier, if any.
+     */
+    meta::type resolve(const std::uint64_t identifier) const noexcept {
+        return find(identifier) ? meta::resolve(std::size_t(identifier)) : meta::type{};
+    }
+
+    /**
+     * @brief Returns false if a view is invalid, true otherwise.
+     * @return False if the view is invalid, true otherwise.
+     */
+    explicit operator bool() const noexcept {
+        return first;
+    }
+
+private:
+    const std::byte *first;
+    size_type types;
+    size_type members;
+    size_type props;
+};
+
+
+}
+
+
+#endif // META_SNAPSHOT_HPP
@@ -0,0 +1,308 @@
+#ifndef META_SPAN_HPP
+#define META_SPAN_HPP
+
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include "meta.hpp"
+
+
+namespace meta {
+
+
+/**
+ * @brief Non-owning view over a homogeneous range of reflected objects.
+ *
+ * A meta span refers to a sequence of objects of the same meta type laid out
+ * in memory at a fixed distance from each other, that is the stride of the
+ * span. Elements are returned as meta handles and are never copied.<br/>
+ * It's the counterpart of a meta handle for ranges of objects: arrays, the
+ * components of a chunk or the records of a memory mapped buffer can be
+ * iterated this way without boxing them into meta any objects.
+ *
+ * The lifetime of the objects isn't managed in any way by the span.
+ */
+class any_span {
+    using byte_type = std::byte;
+
+    class span_iterator {
+        friend class any_span;
+
+        span_iterator(const any_span *parent, const std::size_t pos) noexcept
+            : parent{parent}, pos{pos}
+        {}
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = handle;
+        using pointer = void;
+        using reference = handle;
+        using iterator_category = std::input_iterator_tag;
+
+        span_iterator() noexcept = default;
+
+        span_iterator & operator++() noexcept {
+            return ++pos, *this;
+        }
+
+        span_iterator operator++(int) noexcept {
+            span_iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        bool operator==(const span_iterator &other) const noexcept {
+            return other.pos == pos && other.parent == parent;
+        }
+
+        bool operator!=(const span_iterator &other) const noexcept {
+            return !(*this == other);
+        }
+
+        reference operator*() const noexcept {
+            return (*parent)[pos];
+        }
+
+    private:
+        const any_span *parent{};
+        std::size_t pos{};
+    };
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Input iterator type. */
+    using iterator = span_iterator;
+
+    /*! @brief Default constructor. */
+    any_span() noexcept
+        : owner{},
+          first{nullptr},
+          count{},
+          step{}
+    {}
+
+    /**
+     * @brief Constructs a meta span from a meta type and a range of objects.
+     *
+     * The stride defaults to the size of the underlying type, that is the
+     * objects are tightly packed like in an array. A different stride allows
+     * to visit the same member of an array of aggregates or the objects of an
+     * interleaved buffer.
+     *
+     * @warning
+     * The first element must be an object of the given type, as well as all
+     * the others in the range. Otherwise, using the span results in an
+     * undefined behavior.
+     *
+     * @param type The meta type of the objects.
+     * @param first An opaque pointer to the first object of the range.
+     * @param count Number of objects in the range.
+     * @param stride Distance in bytes between two consecutive objects.
+     */
+    any_span(const meta::type &type, void *first, const size_type count, const size_type stride) noexcept
+        : owner{type},
+          first{static_cast<byte_type *>(first)},
+          count{count},
+          step{stride}
+    {
+        assert(!count || (type && first));
+    }
+
+    /*! @copydoc any_span */
+    any_span(const meta::type &type, void *first, const size_type count) noexcept
+        : any_span{type, first, count, type.size_of()}
+    {}
+
+    /**
+     * @brief Returns the meta type of the elements of a span.
+     * @return The meta type of the elements of the span.
+     */
+    meta::type type() const noexcept {
+        return owner;
+    }
+
+    /**
+     * @brief Returns the number of elements in a span.
+     * @return Number of elements.
+     */
+    size_type size() const noexcept {
+        return count;
+    }
+
+    /**
+     * @brief Returns the distance in bytes between two consecutive elements.
+     * @return The stride of the span.
+     */
+    size_type stride() const noexcept {
+        return step;
+    }
+
+    /**
+     * @brief Checks whether a span is empty.
+     * @return True if the span is empty, false otherwise.
+     */
+    bool empty() const noexcept {
+        return !count;
+    }
+
+    /**
+     * @brief Returns an opaque pointer to the first element of a span.
+     * @return An opaque pointer to the first element, if any.
+     */
+    void * data() const noexcept {
+        return first;
+    }
+
+    /**
+     * @brief Returns a handle to the element at a given position.
+     *
+     * @warning
+     * Attempting to access an element out of bounds results in undefined
+     * behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * of invalid positions.
+     *
+     * @param pos Position of the element to return.
+     * @return A handle to the requested element.
+     */
+    handle operator[](const size_type pos) const noexcept {
+        assert(pos < count);
+        return handle{owner, first + pos * step};
+    }
+
+    /**
+     * @brief Returns a view over a sub-range of a span.
+     *
+     * @warning
+     * Attempting to create a view that exceeds the boundaries of the span
+     * results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * of invalid ranges.
+     *
+     * @param offset Position of the first element of the sub-range.
+     * @param length Number of elements in the sub-range.
+     * @return A view over the requested sub-range.
+     */
+    any_span subspan(const size_type offset, const size_type length) const noexcept {
+        assert(offset + length <= count);
+        return any_span{owner, length ? first + offset * step : first, length, step};
+    }
+
+    /**
+     * @brief Returns an iterator to the first element of a span.
+     * @return An iterator to the first element of the span.
+     */
+    iterator begin() const noexcept {
+        return iterator{this, 0u};
+    }
+
+    /**
+     * @brief Returns an iterator past the last element of a span.
+     * @return An iterator past the last element of the span.
+     */
+    iterator end() const noexcept {
+        return iterator{this, count};
+    }
+
+private:
+    meta::type owner;
+    byte_type *first;
+    size_type count;
+    size_type step;
+};
+
+
+/**
+ * @brief Copies a data member out of a range of objects.
+ *
+ * The values are written one after the other to the output buffer. It must be
+ * suitably sized and aligned to contain as many objects of the type of the
+ * meta data as the elements of the span.<br/>
+ * Data members with a known offset are copied straight from the objects, with
+ * no calls to their getters. Otherwise, getters are used element by element.
+ *
+ * @param data A non-static meta data of a trivially copyable type.
+ * @param range A meta span of objects of the parent type of the meta data.
+ * @param out A pointer to the first byte of the output buffer.
+ * @return True in case of success, false otherwise. Empty spans always
+ * succeed, invalid meta data always fail.
+ */
+inline bool gather(const meta::data &data, const any_span &range, void *out) {
+    if(!data || range.empty()) {
+        // empty spans may have no data at all, there is nothing to copy anyway
+        return static_cast<bool>(data);
+    }
+
+    const auto type = data.type();
+    const auto size = type.size_of();
+    auto *to = static_cast<std::byte *>(out);
+    bool done = range.type() == data.parent() && !data.is_static() && type.is_trivially_copyable();
+
+    if(const auto offset = data.offset(); done && offset != meta::data::npos) {
+        const auto *from = static_cast<const std::byte *>(range.data()) + offset;
+
+        for(any_span::size_type pos{}; pos < range.size(); ++pos) {
+            std::memcpy(to + pos * size, from + pos * range.stride(), size);
+        }
+    } else {
+        for(any_span::size_type pos{}; done && pos < range.size(); ++pos) {
+            const any value = data.get(range[pos]);
+
+            if((done = value && value.data())) {
+                std::memcpy(to + pos * size, value.data(), size);
+            }
+        }
+    }
+
+    return done;
+}
+
+
+/**
+ * @brief Assigns a data member of a range of objects.
+ *
+ * The values are read one after the other from the input buffer. It must
+ * contain as many suitably aligned objects of the type of the meta data as the
+ * elements of the span.<br/>
+ * Data members with a known offset are copied straight into the objects, with
+ * no calls to their setters. Otherwise, setters are used element by element.
+ *
+ * @param data A non-static, non-const meta data of a trivially copyable type.
+ * @param range A meta span of objects of the parent type of the meta data.
+ * @param in A pointer to the first byte of the input buffer.
+ * @return True in case of success, false otherwise. Empty spans always
+ * succeed, invalid meta data always fail.
+ */
+inline bool scatter(const meta::data &data, const any_span &range, const void *in) {
+    if(!data || range.empty()) {
+        // empty spans may have no data at all, there is nothing to copy anyway
+        return static_cast<bool>(data);
+    }
+
+    const auto type = data.type();
+    const auto size = type.size_of();
+    const auto *from = static_cast<const std::byte *>(in);
+    bool done = range.type() == data.parent() && !data.is_static() && !data.is_const() && type.is_trivially_copyable();
+
+    if(const auto offset = data.offset(); done && offset != meta::data::npos) {
+        auto *to = static_cast<std::byte *>(range.data()) + offset;
+
+        for(any_span::size_type pos{}; pos < range.size(); ++pos) {
+            std::memcpy(to + pos * range.stride(), from + pos * size, size);
+        }
+    } else {
+        for(any_span::size_type pos{}; done && pos < range.size(); ++pos) {
+            done = data.set(range[pos], any{handle{type, const_cast<std::byte *>(from + pos * size)}});
+        }
+    }
+
+    return done;
+}
+
+
+}
+
+
+#endif // META_SPAN_HPP
@@ -0,0 +1,252 @@
+#ifndef META_STATS_HPP
+#define META_STATS_HPP
+
+
+#include <cstddef>
+#include <algorithm>
+#ifdef META_COUNTERS
+#include <string>
+#include <iomanip>
+#include <iterator>
+#include <ostream>
+#include <string_view>
+#include "name_table.hpp"
+#endif
+#include "meta.hpp"
+
+
+namespace meta {
+
+
+/*! @brief Shape of the lists walked to look up a kind of meta object. */
+struct chain_stats {
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Longest lookup, in number of nodes visited. */
+    size_type max;
+    /*! @brief Average lookup, in number of nodes visited. */
+    double average;
+    /*! @brief The meta type with the longest lookup, if any. */
+    meta::type longest;
+};
+
+
+/*! @brief Counters and memory usage of all the reflected types. */
+struct registry_stats {
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Number of meta types. */
+    size_type types;
+    /*! @brief Number of meta data. */
+    size_type data;
+    /*! @brief Number of meta functions. */
+    size_type funcs;
+    /*! @brief Number of meta constructors. */
+    size_type ctors;
+    /*! @brief Number of meta conversion functions. */
+    size_type convs;
+    /*! @brief Number of meta bases. */
+    size_type bases;
+    /*! @brief Number of meta properties, members included. */
+    size_type props;
+    /*! @brief Memory in use by the nodes, in bytes. */
+    size_type bytes;
+    /*! @brief Lookup of meta data, bases included. */
+    chain_stats data_chain;
+    /*! @brief Lookup of meta functions, bases included. */
+    chain_stats func_chain;
+    /*! @brief Lookup of meta properties of types, bases included. */
+    chain_stats prop_chain;
+    /*! @brief Deepest hierarchy of bases walked by a lookup. */
+    size_type base_depth;
+};
+
+
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Node>
+std::size_t length(const Node *curr) noexcept {
+    std::size_t count{};
+    iterate([&count](auto *) { ++count; }, curr);
+    return count;
+}
+
+
+template<auto Member>
+std::size_t lookup_length(const type_node *node) noexcept {
+    std::size_t count{};
+    iterate<Member>([&count](auto *) { ++count; }, node);
+    return count;
+}
+
+
+inline std::size_t base_depth(const type_node *node) noexcept {
+    std::size_t depth{};
+
+    for(auto *curr = node->base; curr; curr = curr->next) {
+        depth = (std::max)(depth, base_depth(curr->ref()) + 1u);
+    }
+
+    return depth;
+}
+
+
+template<typename Node>
+std::size_t member_props(const Node *curr) noexcept {
+    std::size_t count{};
+    iterate([&count](auto *member) { count += length(member->prop); }, curr);
+    return count;
+}
+
+
+#ifdef META_COUNTERS
+template<typename Node>
+void dump(std::ostream &out, const char *kind, std::string_view type, std::string_view member, const Node &node) {
+    if(const auto stats = stats_of(node.counters); stats.calls) {
+        out << std::left << std::setw(24) << type << std::setw(6) << kind << std::setw(24) << member << std::right;
+        out << std::setw(12) << stats.calls << std::setw(12) << stats.failures << std::setw(12) << stats.conversions;
+
+        for(auto count: stats.latency) {
+            out << std::setw(10) << count;
+        }
+
+        out << '\n';
+    }
+}
+#endif
+
+
+inline void sample(chain_stats &chain, const std::size_t length, const type_node *node) noexcept {
+    if(!chain.longest || length > chain.max) {
+        chain.max = length;
+        chain.longest = node->ops->clazz();
+    }
+
+    chain.average += length;
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+/**
+ * @brief Collects counters and memory usage of all the reflected types.
+ *
+ * Lookups walk the lists of the meta type first and then those of its bases,
+ * recursively. Chains report the number of nodes visited by a lookup that
+ * fails, that is the worst case for a given meta type.<br/>
+ * Pending registrations are carried out before collecting data, as for the
+ * function used to iterate all the reflected types.
+ *
+ * @return Counters and memory usage of all the reflected types.
+ */
+inline registry_stats stats() noexcept {
+    registry_stats stats{};
+
+    internal::resolve_deferred();
+
+    internal::iterate([&stats](const internal::type_node *node) {
+        const auto data = internal::length(node->data);
+        const auto funcs = internal::length(node->func);
+        const auto ctors = internal::length(node->ctor);
+        const auto convs = internal::length(node->conv);
+        const auto bases = internal::length(node->base);
+        const auto props = internal::length(node->prop) + internal::member_props(node->data) + internal::member_props(node->func) + internal::member_props(node->ctor);
+
+        ++stats.types;
+        stats.data += data;
+        stats.funcs += funcs;
+        stats.ctors += ctors;
+        stats.convs += convs;
+        stats.bases += bases;
+        stats.props += props;
+
+        stats.bytes += sizeof(internal::type_node) + sizeof(internal::type_ops)
+                + data * sizeof(internal::data_node)
+                + funcs * sizeof(internal::func_node)
+                + ctors * sizeof(internal::ctor_node)
+                + convs * sizeof(internal::conv_node)
+                + bases * sizeof(internal::base_node)
+                + props * sizeof(internal::prop_node)
+                + (node->dtor ? sizeof(internal::dtor_node) : 0u);
+
+        internal::sample(stats.data_chain, internal::lookup_length<&internal::type_node::data>(node), node);
+        internal::sample(stats.func_chain, internal::lookup_length<&internal::type_node::func>(node), node);
+        internal::sample(stats.prop_chain, internal::lookup_length<&internal::type_node::prop>(node), node);
+        stats.base_depth = (std::max)(stats.base_depth, internal::base_depth(node));
+    }, internal::type_info<>::type);
+
+    if(stats.types) {
+        stats.data_chain.average /= stats.types;
+        stats.func_chain.average /= stats.types;
+        stats.prop_chain.average /= stats.types;
+    }
+
+    return stats;
+}
+
+
+#ifdef META_COUNTERS
+/**
+ * @brief Prints the counters of all the meta data and meta functions.
+ *
+ * Counters are available only when `META_COUNTERS` is defined.<br/>
+ * A row is printed for each meta data and each meta function used at least
+ * once, along with the latency histogram of its calls. Identifiers are
+ * replaced by their names when a name table that knows them is provided.
+ *
+ * @param out The stream to which to print the table.
+ * @param names An optional name table.
+ */
+inline void dump(std::ostream &out, const name_table *names = nullptr) {
+    const char *header[]{"<100ns", "<1us", "<10us", "<100us", "<1ms", ">=1ms"};
+    static_assert(std::size(header) == member_stats::buckets);
+
+    auto name = [](std::string_view name, const std::size_t identifier) {
+        return name.empty() ? std::to_string(identifier) : std::string{name};
+    };
+
+    out << std::left << std::setw(24) << "type" << std::setw(6) << "kind" << std::setw(24) << "member" << std::right;
+    out << std::setw(12) << "calls" << std::setw(12) << "failures" << std::setw(12) << "conversions";
+
+    for(auto *label: header) {
+        out << std::setw(10) << label;
+    }
+
+    out << '\n';
+
+    internal::iterate([&](const internal::type_node *node) {
+        const auto type = node->ops->clazz();
+        const auto type_name = name(names ? names->type(type.identifier()) : std::string_view{}, type.identifier());
+
+        internal::iterate([&](const internal::data_node *curr) {
+            internal::dump(out, "data", type_name, name(names ? names->data(type, curr->identifier) : std::string_view{}, curr->identifier), *curr);
+        }, node->data);
+
+        internal::iterate([&](const internal::func_node *curr) {
+            internal::dump(out, "func", type_name, name(names ? names->func(type, curr->identifier) : std::string_view{}, curr->identifier), *curr);
+        }, node->func);
+    }, internal::type_info<>::type);
+}
+#endif
+
+
+}
+
+
+#endif // META_STATS_HPP
@@ -0,0 +1,169 @@
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <gtest/gtest.h>
+#include <meta/column.hpp>
+#include <meta/factory.hpp>
+#include <meta/meta.hpp>
+#include "common/allocation.hpp"
+
+enum class allocation_property {
+    key
+};
+
+struct small_type {
+    int value;
+};
+
+struct big_type {
+    big_type() = default;
+    big_type(int first): values{first} {}
+
+    int sum(int lhs, int rhs) const { return values[0u] + lhs + rhs; }
+    double scale(double factor) const { return values[0u] * factor; }
+    small_type small() const { return {values[0u]}; }
+    big_type copy() const { return *this; }
+
+    int values[16u]{};
+};
+
+struct alignas(64u) aligned_type {
+    int value;
+};
+
+struct Allocation: public ::testing::Test {
+    static void SetUpTestCase() {
+        meta::reflect<int>()
+                .conv<double>();
+
+        meta::reflect<big_type>(1u, std::make_pair(allocation_property::key, 42))
+                .ctor<int>()
+                .data<&big_type::values>(1u)
+                .func<&big_type::sum>(2u)
+                .func<&big_type::scale>(3u)
+                .func<&big_type::small>(4u)
+                .func<&big_type::copy>(5u);
+    }
+
+    static void TearDownTestCase() {
+        meta::unregister<big_type>();
+        meta::unregister<int>();
+    }
+};
+
+TEST_F(Allocation, Any) {
+    meta::any small{42};
+    meta::any big{big_type{}};
+    big_type instance{};
+
+    const test::allocation allocation{};
+
+    {
+        meta::any other{42};
+        meta::any copy{small};
+        meta::any moved{std::move(other)};
+        meta::any ref{meta::handle{instance}};
+        meta::any copied{ref};
+        swap(small, big);
+        swap(big, small);
+        meta::any stolen{std::move(copy)};
+        stolen = std::move(big);
+        big = std::move(stolen);
+    }
+
+    ASSERT_EQ(allocation.size(), 0u);
+
+    const test::allocation heap{};
+
+    {
+        meta::any other{big_type{}};
+        meta::any copy{big};
+    }
+
+    ASSERT_EQ(heap.size(), 2u);
+}
+
+TEST_F(Allocation, Cast) {
+    meta::any any{42};
+
+    const test::allocation allocation{};
+
+    const bool cast = any.try_cast<int>() && !any.try_cast<char>();
+    const bool convert = static_cast<bool>(std::as_const(any).convert<double>());
+    const bool in_place = any.convert<double>();
+
+    ASSERT_EQ(allocation.size(), 0u);
+    ASSERT_TRUE(cast);
+    ASSERT_TRUE(convert);
+    ASSERT_TRUE(in_place);
+}
+
+TEST_F(Allocation, Data) {
+    const auto data = meta::resolve<big_type>().data(1u);
+    big_type instance{};
+
+    const test::allocation allocation{};
+
+    const bool get = static_cast<bool>(data.get(instance, 3u));
+    const bool set = data.set(instance, 3u, 42);
+
+    ASSERT_EQ(allocation.size(), 0u);
+    ASSERT_TRUE(get);
+    ASSERT_TRUE(set);
+    ASSERT_EQ(instance.values[3u], 42);
+}
+
+TEST_F(Allocation, Invoke) {
+    const auto type = meta::resolve<big_type>();
+    big_type instance{1};
+
+    const test::allocation allocation{};
+
+    const auto sum = type.func(2u).invoke(instance, 2, 3);
+    const auto scale = type.func(3u).invoke(instance, 2);
+    const auto small = type.invoke(4u, instance);
+
+    ASSERT_EQ(allocation.size(), 0u);
+    ASSERT_EQ(sum.cast<int>(), 6);
+    ASSERT_EQ(scale.cast<double>(), 2.);
+    ASSERT_EQ(small.cast<small_type>().value, 1);
+
+    const test::allocation heap{};
+
+    const auto copy = type.invoke(5u, instance);
+    const auto constructed = type.construct(1);
+
+    ASSERT_EQ(heap.size(), 2u);
+    ASSERT_TRUE(copy);
+    ASSERT_TRUE(constructed);
+}
+
+TEST_F(Allocation, Prop) {
+    const auto type = meta::resolve<big_type>();
+
+    const test::allocation allocation{};
+
+    const auto prop = type.prop(allocation_property::key);
+    const auto value = prop.value();
+
+    ASSERT_EQ(allocation.size(), 0u);
+    ASSERT_EQ(value.cast<int>(), 42);
+}
+
+TEST_F(Allocation, Aligned) {
+    const test::allocation allocation{};
+
+    {
+        meta::column column{meta::resolve<aligned_type>()};
+        column.reserve(4u);
+
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(column.data()) % alignof(aligned_type), 0u);
+
+        // new expressions can be elided, the allocation functions cannot
+        void *instance = ::operator new(sizeof(aligned_type), std::align_val_t{alignof(aligned_type)});
+        ::operator delete(instance, std::align_val_t{alignof(aligned_type)});
+    }
+
+    ASSERT_EQ(allocation.size(), 2u);
+}
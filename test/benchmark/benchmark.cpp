@@ -0,0 +1,262 @@
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <gtest/gtest.h>
+#include <meta/factory.hpp>
+#include <meta/meta.hpp>
+#include "../common/allocation.hpp"
+
+constexpr std::size_t iterations = 1000000u;
+
+template<typename Type>
+void do_not_optimize(const Type &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    const volatile Type *escape = &value;
+    static_cast<void>(*escape);
+#endif
+}
+
+template<typename Func>
+void measure(const std::string &label, Func func) {
+    std::size_t result{};
+
+    const test::allocation allocation{};
+    const auto start = std::chrono::steady_clock::now();
+
+    for(std::size_t pos{}; pos < iterations; ++pos) {
+        result += static_cast<std::size_t>(func());
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    const auto allocations = allocation.size();
+    // results escape so that the compiler cannot discard the calls
+    do_not_optimize(result);
+
+    const std::chrono::duration<double, std::nano> elapsed = end - start;
+
+    std::cout << std::left << std::setw(48) << label << std::right << std::fixed
+              << std::setw(10) << std::setprecision(2) << (elapsed.count() / iterations) << " ns/op"
+              << std::setw(10) << std::setprecision(2) << (static_cast<double>(allocations) / iterations) << " allocs/op"
+              << std::endl;
+}
+
+template<std::size_t Index>
+struct plain_type {
+    int value;
+};
+
+template<std::size_t Members>
+struct wide_type {
+    wide_type() = default;
+    wide_type(int value): values{value} {}
+
+    template<std::size_t Member>
+    int get() const { return values[Member]; }
+
+    template<std::size_t Member>
+    void set(int value) { values[Member] = value; }
+
+    int values[Members]{};
+};
+
+template<std::size_t Depth>
+struct level_type: level_type<Depth - 1u> {};
+
+template<>
+struct level_type<0u> {
+    int value;
+};
+
+struct big_type {
+    double values[8u];
+};
+
+template<std::size_t... Index>
+void reflect_types(std::index_sequence<Index...>) {
+    (meta::reflect<plain_type<Index>>(Index + 1u), ...);
+}
+
+template<std::size_t... Index>
+void unregister_types(std::index_sequence<Index...>) {
+    (meta::unregister<plain_type<Index>>(), ...);
+}
+
+template<std::size_t Members, std::size_t... Member>
+void reflect_members(std::index_sequence<Member...>) {
+    using type = wide_type<Members>;
+    auto factory = meta::reflect<type>().template ctor<int>();
+    (factory.template data<&type::template set<Member>, &type::template get<Member>>(Member + 1u), ...);
+    (factory.template func<&type::template get<Member>>(Member + 1u), ...);
+}
+
+template<std::size_t... Depth>
+void reflect_levels(std::index_sequence<Depth...>) {
+    meta::reflect<level_type<0u>>().data<&level_type<0u>::value>(1u);
+    (meta::reflect<level_type<Depth + 1u>>().template base<level_type<Depth>>(), ...);
+}
+
+template<std::size_t... Depth>
+void unregister_levels(std::index_sequence<Depth...>) {
+    (meta::unregister<level_type<Depth>>(), ...);
+}
+
+template<std::size_t Types>
+void types_benchmark() {
+    reflect_types(std::make_index_sequence<Types>{});
+
+    // types are prepended, the first one registered is the last one found
+    measure("resolve(id), types: " + std::to_string(Types), []() {
+        return static_cast<bool>(meta::resolve(1u));
+    });
+
+    unregister_types(std::make_index_sequence<Types>{});
+}
+
+template<std::size_t Members>
+void members_benchmark() {
+    using type = wide_type<Members>;
+    reflect_members<Members>(std::make_index_sequence<Members>{});
+
+    const auto label = [](const char *what) {
+        return std::string{what} + ", members: " + std::to_string(Members);
+    };
+
+    const auto meta_type = meta::resolve<type>();
+    const auto data = meta_type.data(1u);
+    const auto func = meta_type.func(1u);
+    type instance{};
+
+    measure(label("type::data(id)"), [&meta_type]() {
+        return static_cast<bool>(meta_type.data(1u));
+    });
+
+    measure(label("type::func(id)"), [&meta_type]() {
+        return static_cast<bool>(meta_type.func(1u));
+    });
+
+    measure(label("data::get"), [&data, &instance]() {
+        return static_cast<bool>(data.get(instance));
+    });
+
+    measure(label("data::set"), [&data, &instance]() {
+        return data.set(instance, 42);
+    });
+
+    measure(label("func::invoke"), [&func, &instance]() {
+        return static_cast<bool>(func.invoke(instance));
+    });
+
+    measure(label("type::construct"), [&meta_type]() {
+        return static_cast<bool>(meta_type.construct(42));
+    });
+
+    meta::unregister<type>();
+}
+
+template<std::size_t Depth>
+void hierarchy_benchmark() {
+    using type = level_type<Depth>;
+    reflect_levels(std::make_index_sequence<Depth>{});
+
+    const auto label = [](const char *what) {
+        return std::string{what} + ", depth: " + std::to_string(Depth);
+    };
+
+    const auto meta_type = meta::resolve<type>();
+    const meta::any any{type{}};
+
+    measure(label("any::try_cast (base)"), [&any]() {
+        return any.try_cast<level_type<0u>>() != nullptr;
+    });
+
+    measure(label("type::data(id) (base)"), [&meta_type]() {
+        return static_cast<bool>(meta_type.data(1u));
+    });
+
+    unregister_levels(std::make_index_sequence<Depth + 1u>{});
+}
+
+TEST(Benchmark, Any) {
+    std::cout << "any" << std::endl;
+
+    measure("any(int)", []() {
+        return static_cast<bool>(meta::any{42});
+    });
+
+    measure("any(big_type)", []() {
+        return static_cast<bool>(meta::any{big_type{}});
+    });
+
+    const meta::any small{42};
+    const meta::any big{big_type{}};
+
+    measure("any(const any &), small", [&small]() {
+        return static_cast<bool>(meta::any{small});
+    });
+
+    measure("any(const any &), big", [&big]() {
+        return static_cast<bool>(meta::any{big});
+    });
+
+    meta::any lhs{42};
+    meta::any rhs{big_type{}};
+
+    measure("swap(any &, any &)", [&lhs, &rhs]() {
+        swap(lhs, rhs);
+        return static_cast<bool>(lhs);
+    });
+
+    measure("any::try_cast (exact)", [&small]() {
+        return small.try_cast<int>() != nullptr;
+    });
+
+    measure("any::try_cast (failure)", [&small]() {
+        return small.try_cast<char>() != nullptr;
+    });
+}
+
+TEST(Benchmark, Convert) {
+    std::cout << "convert" << std::endl;
+
+    meta::reflect<int>().conv<double>();
+    const meta::any any{42};
+
+    measure("any::convert (same type)", [&any]() {
+        return static_cast<bool>(any.convert<int>());
+    });
+
+    measure("any::convert (conv)", [&any]() {
+        return static_cast<bool>(any.convert<double>());
+    });
+
+    meta::unregister<int>();
+}
+
+TEST(Benchmark, Types) {
+    std::cout << "types" << std::endl;
+
+    types_benchmark<1u>();
+    types_benchmark<16u>();
+    types_benchmark<256u>();
+}
+
+TEST(Benchmark, Members) {
+    std::cout << "members" << std::endl;
+
+    members_benchmark<1u>();
+    members_benchmark<16u>();
+    members_benchmark<128u>();
+}
+
+TEST(Benchmark, Hierarchy) {
+    std::cout << "hierarchy" << std::endl;
+
+    hierarchy_benchmark<1u>();
+    hierarchy_benchmark<4u>();
+    hierarchy_benchmark<16u>();
+}
@@ -0,0 +1,117 @@
+#
+# Compile-time benchmark
+#
+# Generates translation units that register N types with M data members and M
+# member functions each, compiles them one at a time and reports compile time
+# and object size per configuration.
+#
+# Usage:
+#
+#   cmake -DCOMPILER=<c++> -DINCLUDE_DIR=<meta/src> -DOUTPUT_DIR=<dir>
+#         [-DFLAGS="-std=c++17 -O2"] [-DCONFIGURATIONS=1x1,16x16,...]
+#         -P compile.cmake
+#
+
+cmake_minimum_required(VERSION 3.23)
+
+foreach(VARIABLE COMPILER INCLUDE_DIR OUTPUT_DIR)
+    if(NOT DEFINED ${VARIABLE})
+        message(FATAL_ERROR "${VARIABLE} is required")
+    endif()
+endforeach()
+
+if(NOT DEFINED FLAGS)
+    set(FLAGS "-std=c++17 -O2")
+endif()
+
+if(NOT DEFINED CONFIGURATIONS)
+    set(CONFIGURATIONS "1x1,8x8,16x16,8x32,32x8")
+endif()
+
+separate_arguments(FLAGS)
+string(REPLACE "," ";" CONFIGURATIONS "${CONFIGURATIONS}")
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+function(GENERATE_SOURCE FILENAME TYPES MEMBERS)
+    set(SOURCE "#include <meta/factory.hpp>\n#include <meta/meta.hpp>\n\n")
+    math(EXPR LAST_TYPE "${TYPES} - 1")
+    math(EXPR LAST_MEMBER "${MEMBERS} - 1")
+
+    foreach(TYPE RANGE ${LAST_TYPE})
+        string(APPEND SOURCE "struct type_${TYPE} {\n")
+
+        foreach(MEMBER RANGE ${LAST_MEMBER})
+            string(APPEND SOURCE "    int data_${MEMBER};\n")
+            string(APPEND SOURCE "    int func_${MEMBER}(int value) const { return value + data_${MEMBER}; }\n")
+        endforeach()
+
+        string(APPEND SOURCE "};\n\n")
+    endforeach()
+
+    string(APPEND SOURCE "void reflect_all() {\n")
+
+    foreach(TYPE RANGE ${LAST_TYPE})
+        math(EXPR IDENTIFIER "${TYPE} + 1")
+        string(APPEND SOURCE "    meta::reflect<type_${TYPE}>(${IDENTIFIER}u)")
+
+        foreach(MEMBER RANGE ${LAST_MEMBER})
+            math(EXPR IDENTIFIER "${MEMBER} + 1")
+            string(APPEND SOURCE "\n        .data<&type_${TYPE}::data_${MEMBER}>(${IDENTIFIER}u)")
+            string(APPEND SOURCE "\n        .func<&type_${TYPE}::func_${MEMBER}>(${IDENTIFIER}u)")
+        endforeach()
+
+        string(APPEND SOURCE ";\n")
+    endforeach()
+
+    string(APPEND SOURCE "}\n")
+    file(WRITE ${FILENAME} "${SOURCE}")
+endfunction()
+
+set(REPORT "types,members,seconds,bytes\n")
+
+message("*")
+message("* compile-time benchmark")
+message("*")
+
+foreach(CONFIGURATION ${CONFIGURATIONS})
+    string(REPLACE "x" ";" PAIR ${CONFIGURATION})
+    list(GET PAIR 0 TYPES)
+    list(GET PAIR 1 MEMBERS)
+
+    set(SOURCE_FILE ${OUTPUT_DIR}/registration_${CONFIGURATION}.cpp)
+    set(OBJECT_FILE ${OUTPUT_DIR}/registration_${CONFIGURATION}.o)
+    generate_source(${SOURCE_FILE} ${TYPES} ${MEMBERS})
+
+    string(TIMESTAMP START "%s%f")
+
+    execute_process(
+        COMMAND ${COMPILER} ${FLAGS} -I${INCLUDE_DIR} -c ${SOURCE_FILE} -o ${OBJECT_FILE}
+        RESULT_VARIABLE RESULT
+        ERROR_VARIABLE ERROR
+    )
+
+    string(TIMESTAMP END "%s%f")
+
+    if(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "${CONFIGURATION}: compilation failed\n${ERROR}")
+    endif()
+
+    # microseconds, printed as seconds with three decimal digits
+    math(EXPR ELAPSED "(${END} - ${START}) / 1000")
+    math(EXPR SECONDS "${ELAPSED} / 1000")
+    math(EXPR MILLISECONDS "${ELAPSED} % 1000")
+    string(LENGTH "${MILLISECONDS}" LENGTH)
+
+    while(LENGTH LESS 3)
+        string(PREPEND MILLISECONDS "0")
+        string(LENGTH "${MILLISECONDS}" LENGTH)
+    endwhile()
+
+    file(SIZE ${OBJECT_FILE} BYTES)
+
+    message("* types: ${TYPES}, members: ${MEMBERS}, time: ${SECONDS}.${MILLISECONDS} s, object: ${BYTES} bytes")
+    string(APPEND REPORT "${TYPES},${MEMBERS},${SECONDS}.${MILLISECONDS},${BYTES}\n")
+endforeach()
+
+file(WRITE ${OUTPUT_DIR}/report.csv "${REPORT}")
+message("* report: ${OUTPUT_DIR}/report.csv")
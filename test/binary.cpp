@@ -0,0 +1,215 @@
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+#include <meta/binary.hpp>
+#include <meta/factory.hpp>
+#include <meta/meta.hpp>
+#include <meta/span.hpp>
+
+struct binary_pod {
+    int i;
+    double d;
+};
+
+struct binary_inner {
+    binary_inner() = default;
+    binary_inner(const binary_inner &other): value{other.value} {}
+    binary_inner & operator=(const binary_inner &other) { value = other.value; return *this; }
+
+    std::uint16_t value;
+};
+
+// offsets are known only for trivially default constructible types
+struct binary_type {
+    binary_pod pod;
+    binary_inner inner;
+    int array[3];
+    float unreflected;
+    inline static int counter = 0;
+};
+
+struct binary_invalid {
+    std::string name{};
+};
+
+struct Binary: public ::testing::Test {
+    static void SetUpTestCase() {
+        std::hash<std::string_view> hash{};
+
+        meta::reflect<binary_pod>(hash("pod"))
+                .ctor<>()
+                .data<&binary_pod::d>(hash("d"))
+                .data<&binary_pod::i>(hash("i"));
+
+        meta::reflect<binary_inner>(hash("inner"))
+                .data<&binary_inner::value>(hash("value"));
+
+        // meta data are visited in reverse order of registration
+        meta::reflect<binary_type>(hash("binary"))
+                .ctor<>()
+                .data<&binary_type::counter>(hash("counter"))
+                .data<&binary_type::array>(hash("array"))
+                .data<&binary_type::inner>(hash("inner"))
+                .data<&binary_type::pod>(hash("pod"));
+
+        meta::reflect<binary_invalid>(hash("invalid"))
+                .data<&binary_invalid::name>(hash("name"));
+    }
+
+    static void TearDownTestCase() {
+        meta::unregister<binary_pod>();
+        meta::unregister<binary_inner>();
+        meta::unregister<binary_type>();
+        meta::unregister<binary_invalid>();
+    }
+};
+
+TEST_F(Binary, TriviallyCopyable) {
+    const meta::binary_plan plan{meta::resolve<binary_pod>()};
+
+    ASSERT_TRUE(plan);
+    ASSERT_EQ(plan.type(), meta::resolve<binary_pod>());
+    ASSERT_EQ(plan.size(), sizeof(binary_pod));
+
+    binary_pod instance{42, 3.};
+    std::vector<std::byte> out{};
+
+    ASSERT_TRUE(plan.serialize(instance, out));
+    ASSERT_EQ(out.size(), sizeof(binary_pod));
+    ASSERT_EQ(std::memcmp(out.data(), &instance, sizeof(binary_pod)), 0);
+
+    int other{};
+
+    ASSERT_FALSE(plan.serialize(other, out));
+    ASSERT_EQ(out.size(), sizeof(binary_pod));
+}
+
+TEST_F(Binary, Fields) {
+    const meta::binary_plan plan{meta::resolve<binary_type>()};
+
+    ASSERT_TRUE(plan);
+    ASSERT_EQ(plan.size(), sizeof(binary_pod) + sizeof(std::uint16_t) + sizeof(int[3]));
+
+    binary_type instance{};
+    instance.pod = {42, 3.};
+    instance.inner.value = 7u;
+    instance.array[0] = 1;
+    instance.array[2] = 3;
+    instance.unreflected = 1.5f;
+
+    std::vector<std::byte> out{std::byte{0xFF}};
+
+    ASSERT_TRUE(plan.serialize(instance, out));
+    ASSERT_EQ(out.size(), 1u + plan.size());
+
+    const auto *curr = out.data() + 1u;
+    binary_pod pod{};
+    std::uint16_t value{};
+    int array[3]{};
+
+    // fields with known offsets come first, in the order they are laid out in memory
+    std::memcpy(&pod, curr, sizeof(pod));
+    std::memcpy(array, curr + sizeof(pod), sizeof(array));
+    std::memcpy(&value, curr + sizeof(pod) + sizeof(array), sizeof(value));
+
+    ASSERT_EQ(pod.i, 42);
+    ASSERT_EQ(pod.d, 3.);
+    ASSERT_EQ(value, 7u);
+    ASSERT_EQ(array[0], 1);
+    ASSERT_EQ(array[1], 0);
+    ASSERT_EQ(array[2], 3);
+}
+
+TEST_F(Binary, Range) {
+    const meta::binary_plan plan{meta::resolve<binary_inner>()};
+    binary_inner instances[3]{};
+
+    for(std::uint16_t pos{}; pos < 3u; ++pos) {
+        instances[pos].value = pos;
+    }
+
+    std::vector<std::byte> out{};
+
+    ASSERT_TRUE(plan.serialize(meta::any_span{meta::resolve<binary_inner>(), instances, 3u}, out));
+    ASSERT_EQ(out.size(), 3u * plan.size());
+
+    for(std::uint16_t pos{}; pos < 3u; ++pos) {
+        std::uint16_t value{};
+        std::memcpy(&value, out.data() + pos * plan.size(), sizeof(value));
+        ASSERT_EQ(value, pos);
+    }
+
+    int other[2]{};
+
+    ASSERT_FALSE(plan.serialize(meta::any_span{meta::resolve<int>(), other, 2u}, out));
+    ASSERT_EQ(out.size(), 3u * plan.size());
+}
+
+TEST_F(Binary, Invalid) {
+    ASSERT_FALSE(meta::binary_plan{});
+    ASSERT_FALSE(meta::binary_plan{meta::resolve<binary_invalid>()});
+    ASSERT_FALSE(meta::binary_plan{meta::resolve<int *>()});
+    ASSERT_FALSE(meta::binary_plan{meta::resolve<std::string>()});
+    ASSERT_EQ(meta::binary_plan{meta::resolve<binary_invalid>()}.size(), 0u);
+}
+
+TEST_F(Binary, Deserialize) {
+    const meta::binary_plan plan{meta::resolve<binary_type>()};
+
+    binary_type instance{};
+    instance.pod = {42, 3.};
+    instance.inner.value = 7u;
+    instance.array[1] = 2;
+
+    // misaligned on purpose
+    std::vector<std::byte> buffer{std::byte{}};
+
+    ASSERT_TRUE(plan.serialize(instance, buffer));
+
+    binary_type other{};
+    other.unreflected = 1.5f;
+
+    ASSERT_TRUE(plan.deserialize(buffer.data() + 1u, plan.size(), other));
+    ASSERT_EQ(other.pod.i, 42);
+    ASSERT_EQ(other.pod.d, 3.);
+    ASSERT_EQ(other.inner.value, 7u);
+    ASSERT_EQ(other.array[0], 0);
+    ASSERT_EQ(other.array[1], 2);
+    ASSERT_EQ(other.unreflected, 1.5f);
+
+    ASSERT_FALSE(plan.deserialize(buffer.data() + 1u, plan.size() - 1u, other));
+    ASSERT_FALSE(plan.deserialize(buffer.data() + 1u, plan.size(), instance.pod));
+
+    const auto any = plan.deserialize(buffer.data() + 1u, plan.size());
+
+    ASSERT_TRUE(any);
+    ASSERT_EQ(any.cast<binary_type>().pod.i, 42);
+    ASSERT_EQ(any.cast<binary_type>().inner.value, 7u);
+    ASSERT_FALSE(plan.deserialize(buffer.data() + 1u, 0u));
+}
+
+TEST_F(Binary, DeserializeAt) {
+    const meta::binary_plan plan{meta::resolve<binary_pod>()};
+    binary_pod instances[2]{{1, 1.}, {2, 2.}};
+    std::vector<std::byte> buffer{};
+
+    ASSERT_TRUE(plan.serialize(meta::any_span{meta::resolve<binary_pod>(), instances, 2u}, buffer));
+
+    alignas(binary_pod) std::byte storage[sizeof(binary_pod)];
+
+    ASSERT_TRUE(plan.deserialize_at(buffer.data() + plan.size(), plan.size(), storage));
+    ASSERT_EQ(reinterpret_cast<binary_pod *>(storage)->i, 2);
+    ASSERT_EQ(reinterpret_cast<binary_pod *>(storage)->d, 2.);
+    ASSERT_FALSE(plan.deserialize_at(buffer.data(), 0u, storage));
+
+    binary_pod other[2]{};
+
+    ASSERT_TRUE(plan.deserialize(buffer.data(), buffer.size(), meta::any_span{meta::resolve<binary_pod>(), other, 2u}));
+    ASSERT_EQ(other[0].i, 1);
+    ASSERT_EQ(other[1].d, 2.);
+    ASSERT_FALSE(plan.deserialize(buffer.data(), plan.size(), meta::any_span{meta::resolve<binary_pod>(), other, 2u}));
+}
@@ -0,0 +1,241 @@
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+#include <meta/column.hpp>
+#include <meta/factory.hpp>
+#include <meta/meta.hpp>
+
+struct column_type {
+    column_type(std::string str): value{std::move(str)} { ++alive; }
+    column_type(const column_type &other): value{other.value} { ++alive; }
+    column_type(column_type &&other): value{std::move(other.value)} { ++alive; }
+    ~column_type() { --alive; }
+
+    static void destroy(column_type &) {
+        ++destroyed;
+    }
+
+    inline static int alive = 0;
+    inline static int destroyed = 0;
+
+    std::string value;
+};
+
+struct throwing_column_type {
+    throwing_column_type(int v): value{v} {
+        if(v == fail) {
+            throw v;
+        }
+
+        ++alive;
+    }
+
+    throwing_column_type(const throwing_column_type &other): value{other.value} {
+        if(other.value == fail) {
+            throw other.value;
+        }
+
+        ++alive;
+    }
+
+    ~throwing_column_type() { --alive; }
+
+    inline static int fail = -1;
+    inline static int alive = 0;
+
+    int value;
+};
+
+struct Column: public ::testing::Test {
+    static void SetUpTestCase() {
+        std::hash<std::string_view> hash{};
+
+        meta::reflect<std::string>()
+                .ctor<const char *>();
+
+        meta::reflect<column_type>(hash("column"))
+                .ctor<std::string>()
+                .dtor<&column_type::destroy>();
+
+        meta::reflect<const char *>()
+                .conv<std::string>();
+
+        meta::reflect<throwing_column_type>(hash("throwing_column"))
+                .ctor<int>();
+    }
+
+    static void TearDownTestCase() {
+        meta::unregister<throwing_column_type>();
+        meta::unregister<column_type>();
+        meta::unregister<std::string>();
+        meta::unregister<const char *>();
+    }
+
+    void SetUp() override {
+        column_type::alive = 0;
+        column_type::destroyed = 0;
+    }
+};
+
+TEST_F(Column, Functionalities) {
+    meta::column column{meta::resolve<column_type>()};
+
+    ASSERT_EQ(column.type(), meta::resolve<column_type>());
+    ASSERT_TRUE(column.empty());
+    ASSERT_EQ(column.size(), 0u);
+    ASSERT_EQ(column.capacity(), 0u);
+    ASSERT_EQ(column.data(), nullptr);
+
+    ASSERT_TRUE(column.emplace_back(std::string{"foo"}));
+    ASSERT_TRUE(column.emplace_back(static_cast<const char *>("bar")));
+    ASSERT_FALSE(column.emplace_back(42));
+
+    ASSERT_FALSE(column.empty());
+    ASSERT_EQ(column.size(), 2u);
+    ASSERT_EQ(column.capacity(), 4u);
+    ASSERT_EQ(column[0u].type(), meta::resolve<column_type>());
+    ASSERT_EQ(column[0u].data(), column.data());
+    ASSERT_EQ(static_cast<column_type *>(column[0u].data())->value, "foo");
+    ASSERT_EQ(static_cast<column_type *>(column[1u].data())->value, "bar");
+    ASSERT_EQ(column_type::alive, 2);
+
+    column_type instance{"quux"};
+
+    ASSERT_TRUE(column.push_back(instance));
+    ASSERT_TRUE(column.push_back(column[0u]));
+    ASSERT_FALSE(column.push_back(instance.value));
+    ASSERT_EQ(column.size(), 4u);
+    ASSERT_EQ(static_cast<column_type *>(column[2u].data())->value, "quux");
+    ASSERT_EQ(static_cast<column_type *>(column[3u].data())->value, "foo");
+    ASSERT_EQ(column_type::alive, 5);
+    ASSERT_EQ(column_type::destroyed, 0);
+
+    column.pop_back();
+
+    ASSERT_EQ(column.size(), 3u);
+    ASSERT_EQ(column_type::alive, 4);
+    ASSERT_EQ(column_type::destroyed, 1);
+
+    column.clear();
+
+    ASSERT_TRUE(column.empty());
+    ASSERT_EQ(column.capacity(), 8u);
+    ASSERT_EQ(column_type::alive, 1);
+    ASSERT_EQ(column_type::destroyed, 4);
+}
+
+TEST_F(Column, Reserve) {
+    meta::column column{meta::resolve<int>()};
+    column.reserve(4u);
+
+    ASSERT_EQ(column.capacity(), 4u);
+
+    const auto *data = column.data();
+
+    for(auto i = 0; i < 4; ++i) {
+        int value = i;
+        ASSERT_TRUE(column.push_back(value));
+    }
+
+    ASSERT_EQ(column.data(), data);
+
+    column.reserve(2u);
+
+    ASSERT_EQ(column.capacity(), 4u);
+
+    int value = 4;
+    column.push_back(value);
+
+    ASSERT_EQ(column.capacity(), 8u);
+
+    for(auto i = 0; i < 5; ++i) {
+        ASSERT_EQ(static_cast<const int *>(column.data())[i], i);
+    }
+}
+
+TEST_F(Column, CopyAndMove) {
+    meta::column column{meta::resolve<column_type>()};
+    column.emplace_back(std::string{"foo"});
+
+    meta::column other{column};
+
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_NE(other.data(), column.data());
+    ASSERT_EQ(static_cast<column_type *>(other[0u].data())->value, "foo");
+    ASSERT_EQ(column_type::alive, 2);
+
+    const auto *data = column.data();
+    meta::column moved{std::move(column)};
+
+    ASSERT_EQ(moved.data(), data);
+    ASSERT_EQ(moved.size(), 1u);
+    ASSERT_TRUE(column.empty());
+
+    column = other;
+
+    ASSERT_EQ(column.size(), 1u);
+    ASSERT_EQ(column_type::alive, 3);
+
+    other = std::move(moved);
+
+    ASSERT_EQ(other.data(), data);
+    ASSERT_EQ(column_type::alive, 2);
+}
+
+TEST_F(Column, StrongGuarantee) {
+    meta::column column{meta::resolve<throwing_column_type>()};
+    column.reserve(3u);
+    column.emplace_back(0);
+    column.emplace_back(1);
+    column.emplace_back(2);
+
+    const auto *data = column.data();
+    throwing_column_type::fail = 1;
+
+    ASSERT_THROW(column.reserve(8u), int);
+    ASSERT_THROW(column.emplace_back(3), int);
+    ASSERT_EQ(column.data(), data);
+    ASSERT_EQ(column.size(), 3u);
+    ASSERT_EQ(column.capacity(), 3u);
+
+    for(auto i = 0; i < 3; ++i) {
+        ASSERT_EQ(static_cast<const throwing_column_type *>(column[i].data())->value, i);
+    }
+
+    throwing_column_type::fail = -1;
+}
+
+TEST_F(Column, ThrowingElementWhileGrowing) {
+    throwing_column_type::alive = 0;
+
+    {
+        meta::column column{meta::resolve<throwing_column_type>()};
+        column.emplace_back(0);
+        column.emplace_back(1);
+
+        const auto *data = column.data();
+        throwing_column_type::fail = 2;
+
+        ASSERT_EQ(column.size(), column.capacity());
+        ASSERT_THROW(column.emplace_back(2), int);
+        ASSERT_EQ(column.data(), data);
+        ASSERT_EQ(column.size(), 2u);
+        ASSERT_EQ(throwing_column_type::alive, 2);
+
+        throwing_column_type::fail = -1;
+    }
+
+    ASSERT_EQ(throwing_column_type::alive, 0);
+}
+
+TEST_F(Column, EmplaceBackAliasing) {
+    meta::column column{meta::resolve<column_type>()};
+    column.emplace_back(std::string{"foo"});
+
+    ASSERT_EQ(column.size(), column.capacity());
+
+    // the argument lives in the column, it's read before the column grows
+    ASSERT_TRUE(column.emplace_back(static_cast<column_type *>(column[0u].data())->value));
+    ASSERT_EQ(static_cast<column_type *>(column[0u].data())->value, "foo");
+    ASSERT_EQ(static_cast<column_type *>(column[1u].data())->value, "foo");
+}
@@ -0,0 +1,86 @@
+#ifndef META_TEST_COMMON_ALLOCATION_HPP
+#define META_TEST_COMMON_ALLOCATION_HPP
+
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+
+namespace test {
+
+
+struct allocation {
+    allocation() noexcept
+        : first{count}
+    {}
+
+    std::size_t size() const noexcept {
+        return count - first;
+    }
+
+    inline static std::size_t count = 0u;
+
+private:
+    std::size_t first;
+};
+
+
+}
+
+
+// replacement functions cannot be inline, include this file once per executable
+
+void * operator new(std::size_t size) {
+    ++test::allocation::count;
+
+    if(void *ptr = std::malloc(size ? size : 1u); ptr) {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    ::operator delete(ptr);
+}
+
+void * operator new(std::size_t size, std::align_val_t alignment) {
+    ++test::allocation::count;
+
+    const auto align = static_cast<std::size_t>(alignment);
+    // aligned_alloc wants a size that is a multiple of the alignment
+    const auto length = ((size ? size : 1u) + align - 1u) / align * align;
+
+#ifdef _MSC_VER
+    if(void *ptr = _aligned_malloc(length, align); ptr) {
+#else
+    if(void *ptr = std::aligned_alloc(align, length); ptr) {
+#endif
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t alignment) noexcept {
+    ::operator delete(ptr, alignment);
+}
+
+
+#endif // META_TEST_COMMON_ALLOCATION_HPP
@@ -0,0 +1,106 @@
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <meta/factory.hpp>
+#include <meta/hashed_string.hpp>
+#include <meta/meta.hpp>
+#include <meta/name_table.hpp>
+#include <meta/stats.hpp>
+
+using namespace meta::literals;
+
+struct counted_type {
+    int sum(int other) const { return value + other; }
+    double scale(double factor) const { return value * factor; }
+
+    int value{};
+    int unused{};
+};
+
+struct Counters: public ::testing::Test {
+    static void SetUpTestCase() {
+        meta::reflect<int>()
+                .conv<double>();
+
+        meta::reflect<char>()
+                .conv<int>();
+
+        names.attach();
+
+        meta::reflect<counted_type>("counted_type"_hs)
+                .data<&counted_type::value>("value"_hs)
+                .data<&counted_type::unused>("unused"_hs)
+                .func<&counted_type::sum>("sum"_hs)
+                .func<&counted_type::scale>("scale"_hs);
+
+        names.detach();
+    }
+
+    static void TearDownTestCase() {
+        meta::unregister<counted_type>();
+        meta::unregister<char>();
+        meta::unregister<int>();
+    }
+
+    static meta::name_table names;
+};
+
+meta::name_table Counters::names{};
+
+TEST_F(Counters, Func) {
+    const auto func = meta::resolve<counted_type>().func("sum"_hs);
+    counted_type instance{1};
+    const auto before = func.stats();
+
+    ASSERT_EQ(func.invoke(instance, 2).cast<int>(), 3);
+    ASSERT_EQ(meta::resolve<counted_type>().invoke("sum"_hs, instance, 2).cast<int>(), 3);
+    ASSERT_EQ(func.invoke(instance, 'c').cast<int>(), 1 + 'c');
+    ASSERT_FALSE(func.invoke(instance, counted_type{}));
+
+    const auto after = func.stats();
+
+    ASSERT_EQ(after.calls - before.calls, 4u);
+    ASSERT_EQ(after.failures - before.failures, 1u);
+    // failed attempts to convert an argument aren't conversions
+    ASSERT_EQ(after.conversions - before.conversions, 1u);
+    ASSERT_EQ(std::accumulate(after.latency.cbegin(), after.latency.cend(), std::size_t{}), after.calls);
+    ASSERT_EQ(meta::resolve<counted_type>().func("scale"_hs).stats().calls, 0u);
+}
+
+TEST_F(Counters, Data) {
+    const auto data = meta::resolve<counted_type>().data("value"_hs);
+    counted_type instance{};
+    const auto before = data.stats();
+
+    ASSERT_TRUE(data.set(instance, 42));
+    ASSERT_TRUE(data.set(instance, 'c'));
+    ASSERT_FALSE(data.set(instance, counted_type{}));
+    ASSERT_EQ(data.get(instance).cast<int>(), 'c');
+
+    const auto after = data.stats();
+
+    ASSERT_EQ(after.calls - before.calls, 4u);
+    ASSERT_EQ(after.failures - before.failures, 1u);
+    // failed attempts to convert an argument aren't conversions
+    ASSERT_EQ(after.conversions - before.conversions, 1u);
+    ASSERT_EQ(std::accumulate(after.latency.cbegin(), after.latency.cend(), std::size_t{}), after.calls);
+}
+
+TEST_F(Counters, Dump) {
+    counted_type instance{};
+    std::ostringstream out{};
+
+    meta::resolve<counted_type>().data("value"_hs).set(instance, 42);
+    meta::resolve<counted_type>().func("sum"_hs).invoke(instance, 0);
+    meta::dump(out, &names);
+
+    const auto table = out.str();
+
+    ASSERT_NE(table.find("conversions"), std::string::npos);
+    ASSERT_NE(table.find("counted_type"), std::string::npos);
+    ASSERT_NE(table.find("value"), std::string::npos);
+    ASSERT_NE(table.find("sum"), std::string::npos);
+    ASSERT_EQ(table.find("unused"), std::string::npos);
+    ASSERT_EQ(table.find("scale"), std::string::npos);
+}
@@ -0,0 +1,83 @@
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <gtest/gtest.h>
+#include <meta/factory.hpp>
+#include <meta/hashed_string.hpp>
+#include <meta/meta.hpp>
+
+using namespace meta::literals;
+
+struct hashed_type {
+    int value;
+};
+
+TEST(HashedString, Functionalities) {
+    using hash_type = meta::hashed_string::hash_type;
+
+    const char *bar = "bar";
+
+    auto foo_hs = meta::hashed_string{"foo"};
+    auto bar_hs = meta::hashed_string{bar};
+
+    ASSERT_NE(static_cast<hash_type>(foo_hs), static_cast<hash_type>(bar_hs));
+    ASSERT_STREQ(static_cast<const char *>(foo_hs.data()), "foo");
+    ASSERT_STREQ(static_cast<const char *>(bar_hs.data()), bar);
+
+    ASSERT_EQ(foo_hs, foo_hs);
+    ASSERT_NE(foo_hs, bar_hs);
+
+    meta::hashed_string hs{"foobar"};
+
+    ASSERT_EQ(meta::hashed_string::value("foobar"), hs.value());
+    ASSERT_EQ(meta::hashed_string::value(bar), bar_hs.value());
+    ASSERT_EQ(meta::hashed_string::value("foobar", 3u), foo_hs.value());
+    ASSERT_EQ("foobar"_hs, hs);
+    ASSERT_EQ("foo\0bar"_hs, meta::hashed_string::value("foo\0bar", 7u));
+    ASSERT_NE("foo\0bar"_hs, "foo"_hs);
+    ASSERT_EQ(meta::hashed_string{}.value(), 0u);
+    ASSERT_EQ(meta::hashed_string{}.data(), nullptr);
+    ASSERT_EQ(meta::hashed_string{}.size(), 0u);
+    ASSERT_EQ(foo_hs.size(), 3u);
+    ASSERT_EQ(bar_hs.size(), 3u);
+    ASSERT_EQ("foo\0bar"_hs.size(), 7u);
+    ASSERT_EQ((meta::hashed_string{"foobar", 3u}.size()), 3u);
+}
+
+TEST(HashedString, Stability) {
+    // 64-bit FNV-1a reference values, whatever the width of std::size_t
+    ASSERT_EQ(meta::hashed_string::value(""), static_cast<std::size_t>(0xcbf29ce484222325ull));
+    ASSERT_EQ(meta::hashed_string::value("foo"), static_cast<std::size_t>(0xdcb27518fed9d577ull));
+
+    ASSERT_EQ(meta::hashed_string::value("\xE9"), meta::hashed_string::value(static_cast<const char *>("\xE9")));
+}
+
+TEST(HashedString, Constexprness) {
+    using hash_type = meta::hashed_string::hash_type;
+    constexpr meta::hashed_string hs{"foo"};
+
+    static_assert(std::is_same_v<decltype(hs.value()), hash_type>);
+    static_assert(hs.value() == meta::hashed_string::value("foo"));
+    static_assert(meta::hashed_string::value("quux") == "quux"_hs);
+    static_assert("foo"_hs != "bar"_hs);
+
+    switch(meta::hashed_string::value("bar")) {
+    case "foo"_hs:
+        FAIL();
+        break;
+    case "bar"_hs:
+        SUCCEED();
+        break;
+    }
+}
+
+TEST(HashedString, Identifiers) {
+    meta::reflect<hashed_type>("hashed_type"_hs)
+            .data<&hashed_type::value>("value"_hs);
+
+    ASSERT_EQ(meta::resolve("hashed_type"_hs), meta::resolve<hashed_type>());
+    ASSERT_EQ(meta::resolve<hashed_type>().identifier(), "hashed_type"_hs);
+    ASSERT_TRUE(meta::resolve<hashed_type>().data("value"_hs));
+    ASSERT_TRUE(meta::unregister<hashed_type>());
+}
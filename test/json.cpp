@@ -0,0 +1,222 @@
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+#include <meta/factory.hpp>
+#include <meta/json.hpp>
+#include <meta/meta.hpp>
+
+struct json_point {
+    float x;
+    float y;
+};
+
+struct json_type {
+    int id{};
+    bool flag{};
+    std::string name{};
+    json_point point{};
+    int values[3]{};
+    double ratio{};
+    int hidden{};
+};
+
+struct json_counted {
+    json_counted() = default;
+    json_counted(const json_counted &other): value{other.value} { ++copies; }
+    json_counted & operator=(const json_counted &other) { value = other.value; ++copies; return *this; }
+
+    inline static int copies = 0;
+
+    int value;
+};
+
+struct json_outer {
+    json_counted inner;
+    json_counted list[2];
+};
+
+struct Json: public ::testing::Test {
+    static void SetUpTestCase() {
+        std::hash<std::string_view> hash{};
+
+        meta::reflect<json_point>(hash("point"))
+                .data<&json_point::y>(hash("y"), std::make_pair(meta::json_property::name, "y"))
+                .data<&json_point::x>(hash("x"), std::make_pair(meta::json_property::name, "x"));
+
+        meta::reflect<json_type>(hash("json"))
+                .data<&json_type::hidden>(hash("hidden"))
+                .data<&json_type::ratio>(hash("ratio"), std::make_pair(meta::json_property::name, std::string_view{"ratio"}))
+                .data<&json_type::values>(hash("values"), std::make_pair(meta::json_property::name, "values"))
+                .data<&json_type::point>(hash("point"), std::make_pair(meta::json_property::name, "point"))
+                .data<&json_type::name>(hash("name"), std::make_pair(meta::json_property::name, "name"))
+                .data<&json_type::flag>(hash("flag"), std::make_pair(meta::json_property::name, "flag"))
+                .data<&json_type::id>(hash("id"), std::make_pair(meta::json_property::name, "id"));
+
+        meta::reflect<json_counted>(hash("counted"))
+                .data<&json_counted::value>(hash("value"), std::make_pair(meta::json_property::name, "value"));
+
+        meta::reflect<json_outer>(hash("outer"))
+                .data<&json_outer::list>(hash("list"), std::make_pair(meta::json_property::name, "list"))
+                .data<&json_outer::inner>(hash("inner"), std::make_pair(meta::json_property::name, "inner"));
+    }
+
+    static void TearDownTestCase() {
+        meta::unregister<json_outer>();
+        meta::unregister<json_counted>();
+        meta::unregister<json_point>();
+        meta::unregister<json_type>();
+    }
+};
+
+TEST_F(Json, Writer) {
+    json_type instance{42, true, "a \"quoted\"\n\x01 name", {1.5f, -2.f}, {1, 2, 3}, 0.25, 99};
+    std::string out{};
+
+    {
+        meta::json_writer writer{[&out](const char *str, std::size_t length) { out.append(str, length); }};
+
+        ASSERT_TRUE(writer.write(instance));
+        ASSERT_TRUE(out.empty());
+    }
+
+    ASSERT_EQ(out, R"({"id":42,"flag":true,"name":"a \"quoted\"\n\u0001 name","point":{"x":1.5,"y":-2},"values":[1,2,3],"ratio":0.25})");
+}
+
+TEST_F(Json, WriterChunks) {
+    json_type instance{};
+    instance.name.assign(10000u, 'a');
+    std::string out{};
+    std::size_t chunks{};
+
+    meta::json_writer writer{[&out, &chunks](const char *str, std::size_t length) { out.append(str, length); ++chunks; }};
+
+    ASSERT_TRUE(writer.write(instance));
+    ASSERT_TRUE(writer.write(instance.point));
+    writer.flush();
+
+    ASSERT_GT(chunks, 1u);
+    ASSERT_NE(out.find(instance.name), std::string::npos);
+    ASSERT_EQ(out.substr(out.size() - 13u), R"({"x":0,"y":0})");
+
+    int value = 3;
+    std::string str{"str"};
+    int *ptr = &value;
+
+    out.clear();
+
+    ASSERT_TRUE(writer.write(value));
+    ASSERT_TRUE(writer.write(str));
+    ASSERT_FALSE(writer.write(ptr));
+    writer.flush();
+
+    ASSERT_EQ(out.substr(0u, 6u), R"(3"str")");
+}
+
+TEST_F(Json, Reader) {
+    json_type instance{};
+    instance.hidden = 7;
+    meta::json_reader reader{};
+
+    ASSERT_TRUE(reader.read(R"( {
+        "id": -3, "flag": true, "unknown": {"a": [1, {"b": null}], "c": "x}"},
+        "name": "caf\u00e9 \ud83d\ude00 \"q\"", "point": {"y": 4.5, "x": 1e2},
+        "values": [4, 5], "ratio": null, "hidden": 1
+    } )", instance));
+
+    ASSERT_EQ(instance.id, -3);
+    ASSERT_TRUE(instance.flag);
+    ASSERT_EQ(instance.name, "caf\xC3\xA9 \xF0\x9F\x98\x80 \"q\"");
+    ASSERT_EQ(instance.point.x, 100.f);
+    ASSERT_EQ(instance.point.y, 4.5f);
+    ASSERT_EQ(instance.values[0], 4);
+    ASSERT_EQ(instance.values[1], 5);
+    ASSERT_EQ(instance.values[2], 0);
+    ASSERT_EQ(instance.ratio, 0.);
+    ASSERT_EQ(instance.hidden, 7);
+}
+
+TEST_F(Json, RoundTrip) {
+    json_type instance{42, false, "name", {1.5f, -2.f}, {1, 2, 3}, 0.1, 0};
+    std::string out{};
+
+    {
+        meta::json_writer writer{[&out](const char *str, std::size_t length) { out.append(str, length); }};
+        ASSERT_TRUE(writer.write(instance));
+    }
+
+    json_type other{};
+    meta::json_reader reader{};
+
+    ASSERT_TRUE(reader.read(out, other));
+    ASSERT_EQ(other.id, instance.id);
+    ASSERT_EQ(other.flag, instance.flag);
+    ASSERT_EQ(other.name, instance.name);
+    ASSERT_EQ(other.point.x, instance.point.x);
+    ASSERT_EQ(other.point.y, instance.point.y);
+    ASSERT_EQ(other.values[2], instance.values[2]);
+    ASSERT_EQ(other.ratio, instance.ratio);
+}
+
+TEST_F(Json, ReaderErrors) {
+    json_type instance{};
+    meta::json_reader reader{};
+
+    ASSERT_FALSE(reader.read(R"({"id": "text"})", instance));
+    ASSERT_FALSE(reader.read(R"({"values": [1, 2, 3, 4]})", instance));
+    ASSERT_FALSE(reader.read(R"({"id": 1)", instance));
+    ASSERT_FALSE(reader.read(R"({"id": 1} trailing)", instance));
+    ASSERT_FALSE(reader.read(R"({"name": "\x"})", instance));
+    ASSERT_FALSE(reader.read(R"({"name": "\udc00"})", instance));
+    ASSERT_FALSE(reader.read(R"({"name": "\ud83d"})", instance));
+    ASSERT_FALSE(reader.read(R"({"name": "\u00)", instance));
+    ASSERT_FALSE(reader.read(R"({"ratio": inf})", instance));
+    ASSERT_FALSE(reader.read(R"({"ratio": nan})", instance));
+    ASSERT_FALSE(reader.read(R"({"ratio": 1.})", instance));
+    ASSERT_FALSE(reader.read(R"({"ratio": .5})", instance));
+    ASSERT_FALSE(reader.read(R"({"ratio": 1e})", instance));
+    ASSERT_FALSE(reader.read(R"({"id": +1})", instance));
+    ASSERT_FALSE(reader.read(R"({"id": 01})", instance));
+    ASSERT_FALSE(reader.read(R"({"id": 1.5})", instance));
+    ASSERT_FALSE(reader.read(R"({"unknown": garbage})", instance));
+    ASSERT_FALSE(reader.read(R"({"unknown": 01})", instance));
+    ASSERT_FALSE(reader.read(R"({"unknown": -})", instance));
+    ASSERT_FALSE(reader.read(R"({"unknown": nulls})", instance));
+    ASSERT_TRUE(reader.read(R"({"unknown": [-0.5e+3, true, false, null, "x", {"k": 0}]})", instance));
+    ASSERT_TRUE(reader.read(R"({"ratio": -1.25E-1})", instance));
+    ASSERT_EQ(instance.ratio, -.125);
+    ASSERT_TRUE(reader.read(R"({})", instance));
+}
+
+TEST_F(Json, InPlace) {
+    json_outer instance{};
+    instance.inner.value = 1;
+    instance.list[1].value = 3;
+    json_counted::copies = 0;
+    std::string out{};
+
+    {
+        meta::json_writer writer{[&out](const char *str, std::size_t length) { out.append(str, length); }};
+        ASSERT_TRUE(writer.write(instance));
+    }
+
+    ASSERT_EQ(out, R"({"inner":{"value":1},"list":[{"value":0},{"value":3}]})");
+
+    json_outer other{};
+    meta::json_reader reader{};
+
+    ASSERT_TRUE(reader.read(out, other));
+    ASSERT_EQ(other.inner.value, 1);
+    ASSERT_EQ(other.list[1].value, 3);
+    ASSERT_EQ(json_counted::copies, 0);
+}
+
+TEST_F(Json, ThrowingSink) {
+    json_type instance{};
+
+    {
+        meta::json_writer writer{[](const char *, std::size_t) { throw 42; }};
+        ASSERT_TRUE(writer.write(instance));
+    }
+
+    SUCCEED();
+}
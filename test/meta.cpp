@@ -1,3 +1,5 @@
+#include <new>
+#include <cstddef>
 #include <utility>
 #include <functional>
 #include <type_traits>
@@ -74,6 +76,14 @@ derived_type derived_factory(const base_type &, int value) {
     return {derived_type{}, value, 'c'};
 }
 
+struct ctor_type {
+    ctor_type(int value): i{value} {}
+    ctor_type(double value): d{value} {}
+
+    int i{};
+    double d{};
+};
+
 struct data_type {
     int i{0};
     const int j{1};
@@ -83,6 +93,30 @@ struct data_type {
     int v{0};
 };
 
+struct layout_type {
+    int i;
+    char c;
+    double d;
+};
+
+struct const_layout_type {
+    const int i;
+};
+
+struct initialized_layout_type {
+    int i{3};
+    double d{1.};
+};
+
+struct plain_setter_type {
+    void set(int v) { ++calls; value = v; }
+    int get() const { return value; }
+
+    inline static int calls = 0;
+
+    int value;
+};
+
 struct array_type {
     static inline int global[3];
     int local[3];
@@ -103,6 +137,13 @@ struct func_type {
     inline static int value = 0;
 };
 
+struct overloaded_type {
+    int f(int v) const { return v; }
+    double f(double v) const { return 2. * v; }
+    int f(int a, int b) const { return a + b; }
+    static char f(char c) { return c; }
+};
+
 struct setter_getter_type {
     int value{};
 
@@ -116,6 +157,15 @@ struct setter_getter_type {
     static int static_getter(const setter_getter_type &type) { return type.value; }
 };
 
+struct strict_type {
+    int f(const base_type &, int v) const { return v; }
+    void g(int v) { value = v; }
+    int h(int) const { return 1; }
+    int i(char) const { return 2; }
+
+    int value{};
+};
+
 struct not_comparable_type {
     bool operator==(const not_comparable_type &) const = delete;
 };
@@ -141,6 +191,25 @@ struct concrete_type: an_abstract_type, another_abstract_type {
     void h(char c) override { j = c; }
 };
 
+struct ctor_base_type {
+    ctor_base_type(int v): i{v} {}
+    int i;
+};
+
+struct ctor_derived_type: ctor_base_type {
+    ctor_derived_type(): ctor_base_type{-1} {}
+};
+
+template<int>
+struct deferred_type {
+    inline static int registered = 0;
+    int value;
+};
+
+struct deferred_user_type {
+    int f(const deferred_type<3> &other) const { return other.value; }
+};
+
 struct Meta: public ::testing::Test {
     static void SetUpTestCase() {
         meta::reflect<double>().conv<int>();
@@ -165,6 +234,10 @@ struct Meta: public ::testing::Test {
                 .conv<&derived_type::f>()
                 .conv<&derived_type::g>();
 
+        meta::reflect<ctor_type>(hash("ctor"))
+                .ctor<double>()
+                .ctor<int>();
+
         meta::reflect<empty_type>(hash("empty"))
                 .dtor<&empty_type::destroy>();
 
@@ -194,12 +267,25 @@ struct Meta: public ::testing::Test {
                 .func<&func_type::v, meta::as_void_t>(hash("v"))
                 .func<&func_type::a, meta::as_alias_t>(hash("a"));
 
+        meta::reflect<overloaded_type>(hash("overloaded"))
+                .func<static_cast<int(overloaded_type:: *)(int) const>(&overloaded_type::f)>(hash("f"))
+                .func<static_cast<double(overloaded_type:: *)(double) const>(&overloaded_type::f)>(hash("f"))
+                .func<static_cast<int(overloaded_type:: *)(int, int) const>(&overloaded_type::f)>(hash("f"))
+                .func<static_cast<char(*)(char)>(&overloaded_type::f)>(hash("f"));
+
         meta::reflect<setter_getter_type>(hash("setter_getter"))
                 .data<&setter_getter_type::static_setter, &setter_getter_type::static_getter>(hash("x"))
                 .data<&setter_getter_type::setter, &setter_getter_type::getter>(hash("y"))
                 .data<&setter_getter_type::static_setter, &setter_getter_type::getter>(hash("z"))
                 .data<&setter_getter_type::setter_with_ref, &setter_getter_type::getter_with_ref>(hash("w"));
 
+        meta::reflect<strict_type>(hash("strict"))
+                .data<&strict_type::value, meta::as_strict_t>(hash("value"))
+                .data<&strict_type::g, &strict_type::value, meta::as_strict_t>(hash("g"))
+                .func<&strict_type::f, meta::as_strict_t>(hash("f"))
+                .func<&strict_type::h, meta::as_strict_t>(hash("h"))
+                .func<&strict_type::i>(hash("h"));
+
         meta::reflect<an_abstract_type>(hash("an_abstract_type"), std::make_pair(properties::prop_bool, false))
                 .data<&an_abstract_type::i>(hash("i"))
                 .func<&an_abstract_type::f>(hash("f"))
@@ -1053,6 +1139,37 @@ TEST_F(Meta, MetaCtorCastAndConvert) {
     ASSERT_EQ(any.cast<derived_type>().c, 'c');
 }
 
+TEST_F(Meta, MetaCtorConstructAt) {
+    auto ctor = meta::resolve<derived_type>().ctor<const base_type &, int, char>();
+    std::aligned_storage_t<sizeof(derived_type), alignof(derived_type)> storage;
+
+    ASSERT_FALSE(ctor.construct_at(&storage, base_type{}, 42));
+    ASSERT_FALSE(ctor.construct_at(&storage, base_type{}, 'c', 42));
+    ASSERT_TRUE(ctor.construct_at(&storage, derived_type{}, 42., 'c'));
+
+    auto *instance = std::launder(reinterpret_cast<derived_type *>(&storage));
+
+    ASSERT_EQ(instance->i, 42);
+    ASSERT_EQ(instance->c, 'c');
+
+    instance->~derived_type();
+}
+
+TEST_F(Meta, MetaCtorFuncConstructAt) {
+    auto ctor = meta::resolve<derived_type>().ctor<const base_type &, int>();
+    std::aligned_storage_t<sizeof(derived_type), alignof(derived_type)> storage;
+
+    ASSERT_FALSE(ctor.construct_at(&storage, base_type{}, 'c'));
+    ASSERT_TRUE(ctor.construct_at(&storage, base_type{}, 42));
+
+    auto *instance = std::launder(reinterpret_cast<derived_type *>(&storage));
+
+    ASSERT_EQ(instance->i, 42);
+    ASSERT_EQ(instance->c, 'c');
+
+    instance->~derived_type();
+}
+
 TEST_F(Meta, MetaCtorFuncMetaAnyArgs) {
     auto ctor = meta::resolve<derived_type>().ctor<const base_type &, int>();
     auto any = ctor.invoke(base_type{}, meta::any{42});
@@ -1408,6 +1525,23 @@ TEST_F(Meta, MetaDataAsVoid) {
     ASSERT_EQ(data.get(instance), meta::any{std::in_place_type<void>});
 }
 
+TEST_F(Meta, MetaDataAsStrict) {
+    std::hash<std::string_view> hash{};
+    strict_type instance{};
+    auto value = meta::resolve<strict_type>().data(hash("value"));
+    auto g = meta::resolve<strict_type>().data(hash("g"));
+
+    ASSERT_TRUE(value.set(instance, 42));
+    ASSERT_TRUE(value.set(instance, meta::any{3}));
+    ASSERT_FALSE(value.set(instance, 42.));
+    ASSERT_FALSE(value.set(instance, meta::any{42.}));
+    ASSERT_EQ(value.get(instance).cast<int>(), 3);
+
+    ASSERT_TRUE(g.set(instance, 1));
+    ASSERT_FALSE(g.set(instance, 2.));
+    ASSERT_EQ(g.get(instance).cast<int>(), 1);
+}
+
 TEST_F(Meta, MetaDataAsAlias) {
     std::hash<std::string_view> hash{};
     data_type instance{};
@@ -1658,6 +1792,22 @@ TEST_F(Meta, MetaFuncAsAlias) {
     ASSERT_EQ(instance.value, 3);
 }
 
+TEST_F(Meta, MetaFuncAsStrict) {
+    std::hash<std::string_view> hash{};
+    strict_type instance{};
+    auto func = meta::resolve<strict_type>().func(hash("f"));
+
+    ASSERT_EQ(func.ret(), meta::resolve<int>());
+    ASSERT_EQ(func.invoke(instance, base_type{}, 42).cast<int>(), 42);
+    ASSERT_EQ(func.invoke(instance, derived_type{}, 42).cast<int>(), 42);
+    ASSERT_FALSE(func.invoke(instance, base_type{}, 42.));
+    ASSERT_TRUE(meta::any{42.}.convert<int>());
+
+    // both overloads require a conversion, the strict one isn't viable
+    ASSERT_EQ(meta::resolve<strict_type>().invoke(hash("h"), instance, 1).cast<int>(), 1);
+    ASSERT_EQ(meta::resolve<strict_type>().invoke(hash("h"), instance, derived_type{}).cast<int>(), 2);
+}
+
 TEST_F(Meta, MetaFuncByReference) {
     std::hash<std::string_view> hash{};
     auto func = meta::resolve<func_type>().func(hash("h"));
@@ -1671,6 +1821,59 @@ TEST_F(Meta, MetaFuncByReference) {
     ASSERT_EQ(value, 8);
 }
 
+TEST_F(Meta, MetaFuncOverload) {
+    std::hash<std::string_view> hash{};
+    auto type = meta::resolve<overloaded_type>();
+    overloaded_type instance{};
+    int counter{};
+
+    type.func([&counter](auto func) {
+        ASSERT_EQ(func.parent(), meta::resolve<overloaded_type>());
+        ++counter;
+    });
+
+    ASSERT_EQ(counter, 4);
+    ASSERT_TRUE(type.func(hash("f")));
+
+    // the first overload registered is returned
+    ASSERT_EQ(type.func(hash("f")).size(), 1u);
+    ASSERT_EQ(type.func(hash("f")).arg(0u), meta::resolve<int>());
+    ASSERT_EQ(type.func(hash("f")).ret(), meta::resolve<int>());
+
+    for(auto i = 0; i < 2; ++i) {
+        ASSERT_EQ(type.invoke(hash("f"), instance, 3).cast<int>(), 3);
+        ASSERT_EQ(type.invoke(hash("f"), instance, 3.).cast<double>(), 6.);
+        ASSERT_EQ(type.invoke(hash("f"), instance, meta::any{1}, 2).cast<int>(), 3);
+        ASSERT_EQ(type.invoke(hash("f"), {}, 'c').cast<char>(), 'c');
+    }
+
+    ASSERT_FALSE(type.invoke(hash("f"), instance, 1, 2, 3));
+    ASSERT_FALSE(type.invoke(hash("f"), instance, instance));
+    ASSERT_FALSE(type.invoke(hash("g"), instance, 1));
+}
+
+TEST_F(Meta, CallSite) {
+    std::hash<std::string_view> hash{};
+    meta::call_site site{hash("f")};
+    overloaded_type overloaded{};
+    concrete_type concrete{};
+
+    ASSERT_EQ(site.identifier(), hash("f"));
+
+    for(auto i = 0; i < 2; ++i) {
+        ASSERT_EQ(site.invoke(overloaded, 3).cast<int>(), 3);
+        ASSERT_EQ(site.invoke(overloaded, 3.).cast<double>(), 6.);
+        ASSERT_EQ(site.invoke(overloaded, meta::any{1}, 2).cast<int>(), 3);
+        ASSERT_TRUE(site.invoke(concrete, 3));
+        ASSERT_EQ(concrete.i, 9);
+        ASSERT_TRUE(site.invoke(concrete, 3.));
+        ASSERT_EQ(concrete.i, 9);
+        ASSERT_FALSE(site.invoke(concrete, 'c'));
+        ASSERT_FALSE(site.invoke({}, 3));
+        concrete.i = {};
+    }
+}
+
 TEST_F(Meta, MetaType) {
     auto type = meta::resolve<derived_type>();
 
@@ -1705,12 +1908,56 @@ TEST_F(Meta, MetaTypeTraits) {
     ASSERT_TRUE(meta::resolve<decltype(&func_type::g)>().is_member_function_pointer());
 }
 
+TEST_F(Meta, MetaTypeLayout) {
+    ASSERT_EQ(meta::resolve<void>().size_of(), 0u);
+    ASSERT_EQ(meta::resolve<void>().align_of(), 0u);
+    ASSERT_EQ(meta::resolve<int(char, double)>().size_of(), 0u);
+    ASSERT_EQ(meta::resolve<int>().size_of(), sizeof(int));
+    ASSERT_EQ(meta::resolve<int>().align_of(), alignof(int));
+    ASSERT_EQ(meta::resolve<fat_type>().size_of(), sizeof(fat_type));
+    ASSERT_EQ(meta::resolve<fat_type>().align_of(), alignof(fat_type));
+    ASSERT_EQ(meta::resolve<array_type>().size_of(), sizeof(array_type));
+
+    ASSERT_TRUE(meta::resolve<int>().is_trivially_copyable());
+    ASSERT_TRUE(meta::resolve<union_type>().is_trivially_copyable());
+    ASSERT_FALSE(meta::resolve<fat_type>().is_trivially_copyable());
+    ASSERT_FALSE(meta::resolve<void>().is_trivially_copyable());
+
+    ASSERT_TRUE(meta::resolve<ctor_type>().is_trivially_destructible());
+    ASSERT_FALSE(meta::resolve<derived_type>().is_trivially_destructible());
+
+    ASSERT_TRUE(meta::resolve<derived_type>().is_default_constructible());
+    ASSERT_FALSE(meta::resolve<ctor_type>().is_default_constructible());
+    ASSERT_FALSE(meta::resolve<an_abstract_type>().is_default_constructible());
+}
+
+TEST_F(Meta, MetaTypeTraitsMask) {
+    constexpr auto arithmetic_or_enum = meta::type_traits::is_integral | meta::type_traits::is_floating_point | meta::type_traits::is_enum;
+
+    ASSERT_EQ(meta::resolve<void>().traits(), meta::type_traits::is_void);
+    ASSERT_EQ(meta::resolve<int>().traits() & meta::type_traits::is_integral, meta::type_traits::is_integral);
+    ASSERT_EQ(meta::resolve<int>().traits() & meta::type_traits::is_class, meta::type_traits::none);
+
+    ASSERT_TRUE(meta::resolve<int>().is(arithmetic_or_enum));
+    ASSERT_TRUE(meta::resolve<double>().is(arithmetic_or_enum));
+    ASSERT_TRUE(meta::resolve<properties>().is(arithmetic_or_enum));
+    ASSERT_FALSE(meta::resolve<fat_type>().is(arithmetic_or_enum));
+    ASSERT_FALSE(meta::resolve<int *>().is(arithmetic_or_enum));
+    ASSERT_FALSE(meta::resolve<int>().is(meta::type_traits::none));
+}
+
 TEST_F(Meta, MetaTypeRemovePointer) {
     ASSERT_EQ(meta::resolve<void *>().remove_pointer(), meta::resolve<void>());
     ASSERT_EQ(meta::resolve<int(*)(char, double)>().remove_pointer(), meta::resolve<int(char, double)>());
     ASSERT_EQ(meta::resolve<derived_type>().remove_pointer(), meta::resolve<derived_type>());
 }
 
+TEST_F(Meta, MetaTypeRemoveExtent) {
+    ASSERT_EQ(meta::resolve<int[3]>().remove_extent(), meta::resolve<int>());
+    ASSERT_EQ(meta::resolve<int[2][3]>().remove_extent(), meta::resolve<int[3]>());
+    ASSERT_EQ(meta::resolve<derived_type>().remove_extent(), meta::resolve<derived_type>());
+}
+
 TEST_F(Meta, MetaTypeBase) {
     std::hash<std::string_view> hash{};
     auto type = meta::resolve<derived_type>();
@@ -1755,6 +2002,15 @@ TEST_F(Meta, MetaTypeCtor) {
     ASSERT_TRUE((type.ctor<const derived_type &, double>()));
 }
 
+TEST_F(Meta, MetaTypeCtorExactMatch) {
+    auto type = meta::resolve<ctor_type>();
+
+    ASSERT_EQ((type.ctor<int>().arg(meta::ctor::size_type{0})), meta::resolve<int>());
+    ASSERT_EQ((type.ctor<double>().arg(meta::ctor::size_type{0})), meta::resolve<double>());
+    ASSERT_EQ((type.ctor<const double &>()), (type.ctor<double>()));
+    ASSERT_FALSE((type.ctor<char>()));
+}
+
 TEST_F(Meta, MetaTypeDtor) {
     ASSERT_TRUE(meta::resolve<fat_type>().dtor());
     ASSERT_FALSE(meta::resolve<int>().dtor());
@@ -1828,6 +2084,65 @@ TEST_F(Meta, MetaTypeConstructCastAndConvert) {
     ASSERT_EQ(any.cast<derived_type>().c, 'c');
 }
 
+TEST_F(Meta, MetaTypeConstructExactMatch) {
+    auto type = meta::resolve<ctor_type>();
+
+    for(auto i = 0; i < 2; ++i) {
+        auto any = type.construct(42.);
+
+        ASSERT_TRUE(any);
+        ASSERT_EQ(any.cast<ctor_type>().i, 0);
+        ASSERT_EQ(any.cast<ctor_type>().d, 42.);
+
+        any = type.construct(meta::any{3});
+
+        ASSERT_TRUE(any);
+        ASSERT_EQ(any.cast<ctor_type>().i, 3);
+        ASSERT_EQ(any.cast<ctor_type>().d, 0.);
+    }
+
+    ASSERT_FALSE(type.construct('c'));
+}
+
+TEST_F(Meta, MetaTypeConstructAt) {
+    auto type = meta::resolve<ctor_type>();
+    std::aligned_storage_t<sizeof(ctor_type), alignof(ctor_type)> storage;
+
+    ASSERT_FALSE(type.construct_at(&storage, 'c'));
+    ASSERT_TRUE(type.construct_at(&storage, 42.));
+    ASSERT_EQ(std::launder(reinterpret_cast<ctor_type *>(&storage))->i, 0);
+    ASSERT_EQ(std::launder(reinterpret_cast<ctor_type *>(&storage))->d, 42.);
+
+    ASSERT_TRUE(type.construct_at(&storage, meta::any{3}));
+    ASSERT_EQ(std::launder(reinterpret_cast<ctor_type *>(&storage))->i, 3);
+    ASSERT_EQ(std::launder(reinterpret_cast<ctor_type *>(&storage))->d, 0.);
+}
+
+TEST_F(Meta, MetaTypeConstructBaseCtor) {
+    std::hash<std::string_view> hash{};
+
+    meta::reflect<ctor_base_type>(hash("ctor_base"))
+            .ctor<int>();
+
+    meta::reflect<ctor_derived_type>(hash("ctor_derived"))
+            .base<ctor_base_type>()
+            .ctor<>();
+
+    auto type = meta::resolve<ctor_derived_type>();
+    std::aligned_storage_t<sizeof(ctor_derived_type), alignof(ctor_derived_type)> storage;
+
+    ASSERT_EQ(type.construct().type(), type);
+    ASSERT_EQ(type.construct().cast<ctor_derived_type>().i, -1);
+
+    // constructors of the base classes are searched when the type has none that fits
+    ASSERT_EQ(type.construct(42).type(), meta::resolve<ctor_base_type>());
+    ASSERT_EQ(type.construct(42).cast<ctor_base_type>().i, 42);
+    ASSERT_FALSE(type.construct_at(&storage, 42));
+
+    ASSERT_TRUE(meta::unregister<ctor_derived_type>());
+    ASSERT_TRUE(meta::unregister<ctor_base_type>());
+}
+
 TEST_F(Meta, MetaTypeDestroyDtor) {
     auto type = meta::resolve<empty_type>();
     empty_type instance;
@@ -1890,6 +2205,83 @@ TEST_F(Meta, MetaDataFromBase) {
     ASSERT_EQ(instance.j, 'c');
 }
 
+TEST_F(Meta, MetaDataOffset) {
+    std::hash<std::string_view> hash{};
+
+    meta::reflect<layout_type>(hash("layout"))
+            .data<&layout_type::i>(hash("i"))
+            .data<&layout_type::c, meta::as_alias_t>(hash("c"))
+            .data<&layout_type::d>(hash("d"));
+
+    meta::reflect<const_layout_type>(hash("const_layout"))
+            .data<&const_layout_type::i>(hash("i"));
+
+    meta::reflect<initialized_layout_type>(hash("initialized_layout"))
+            .data<&initialized_layout_type::i>(hash("i"))
+            .data<&initialized_layout_type::d>(hash("d"));
+
+    auto type = meta::resolve<layout_type>();
+    layout_type instance{0, 'c', 0.};
+
+    ASSERT_EQ(type.data(hash("i")).offset(), offsetof(layout_type, i));
+    ASSERT_EQ(type.data(hash("d")).offset(), offsetof(layout_type, d));
+
+    ASSERT_TRUE(type.data(hash("i")).set(instance, 42));
+    ASSERT_TRUE(type.data(hash("d")).set(instance, 3.));
+    ASSERT_TRUE(type.data(hash("d")).set(instance, meta::any{.5}));
+
+    ASSERT_EQ(instance.i, 42);
+    ASSERT_EQ(instance.d, .5);
+
+    // policies other than the default one are never bypassed
+    ASSERT_EQ(type.data(hash("c")).offset(), meta::data::npos);
+    ASSERT_TRUE(type.data(hash("c")).set(instance, 'x'));
+    ASSERT_EQ(instance.c, 'x');
+
+    // constant members have an offset, they are read in place but never written
+    const_layout_type other{0};
+
+    ASSERT_EQ(meta::resolve<const_layout_type>().data(hash("i")).offset(), offsetof(const_layout_type, i));
+    ASSERT_FALSE(meta::resolve<const_layout_type>().data(hash("i")).set(other, 42));
+    ASSERT_EQ(meta::resolve<const_layout_type>().data(hash("i")).get(other).cast<int>(), 0);
+    ASSERT_EQ(other.i, 0);
+
+    // default member initializers don't prevent offsets
+    initialized_layout_type initialized{};
+
+    ASSERT_EQ(meta::resolve<initialized_layout_type>().data(hash("d")).offset(), offsetof(initialized_layout_type, d));
+    ASSERT_TRUE(meta::resolve<initialized_layout_type>().data(hash("d")).set(initialized, 2.));
+    ASSERT_EQ(meta::resolve<initialized_layout_type>().data(hash("d")).get(initialized).cast<double>(), 2.);
+    ASSERT_EQ(type.data(hash("d")).get(instance).cast<double>(), .5);
+
+    ASSERT_EQ(meta::resolve<data_type>().data(hash("i")).offset(), meta::data::npos);
+    ASSERT_EQ(meta::resolve<data_type>().data(hash("h")).offset(), meta::data::npos);
+    ASSERT_EQ(meta::resolve<setter_getter_type>().data(hash("x")).offset(), meta::data::npos);
+
+    meta::unregister<initialized_layout_type>();
+    meta::unregister<const_layout_type>();
+    meta::unregister<layout_type>();
+}
+
+TEST_F(Meta, MetaDataOffsetCustomSetter) {
+    std::hash<std::string_view> hash{};
+
+    meta::reflect<plain_setter_type>(hash("plain_setter"))
+            .data<&plain_setter_type::set, &plain_setter_type::get>(hash("value"));
+
+    auto data = meta::resolve<plain_setter_type>().data(hash("value"));
+    plain_setter_type instance{};
+    plain_setter_type::calls = 0;
+
+    // custom setters are invoked even for values of the exact type
+    ASSERT_EQ(data.offset(), meta::data::npos);
+    ASSERT_TRUE(data.set(instance, 42));
+    ASSERT_EQ(instance.value, 42);
+    ASSERT_EQ(plain_setter_type::calls, 1);
+
+    meta::unregister<plain_setter_type>();
+}
+
 TEST_F(Meta, MetaFuncFromBase) {
     std::hash<std::string_view> hash{};
     auto type = meta::resolve<concrete_type>();
@@ -1997,9 +2389,100 @@ TEST_F(Meta, Variables) {
     ASSERT_EQ(c, 'x');
 }
 
+TEST_F(Meta, DeferredRegistration) {
+    std::hash<std::string_view> hash{};
+
+    meta::defer<deferred_type<0>>(hash("deferred_0"), []() {
+        ++deferred_type<0>::registered;
+        meta::reflect<deferred_type<0>>(std::hash<std::string_view>{}("deferred_0"))
+                .data<&deferred_type<0>::value>(std::hash<std::string_view>{}("value"));
+    });
+
+    meta::defer<deferred_type<1>>(hash("deferred_1"), []() {
+        ++deferred_type<1>::registered;
+        meta::reflect<deferred_type<1>>(std::hash<std::string_view>{}("deferred_1"));
+    });
+
+    meta::defer<deferred_type<2>>(hash("deferred_2"), []() {
+        ++deferred_type<2>::registered;
+        meta::reflect<deferred_type<2>>(std::hash<std::string_view>{}("deferred_2"));
+    });
+
+    ASSERT_EQ(deferred_type<0>::registered, 0);
+    ASSERT_EQ(deferred_type<1>::registered, 0);
+    ASSERT_EQ(deferred_type<2>::registered, 0);
+
+    ASSERT_EQ(meta::resolve(hash("deferred_0")), meta::resolve<deferred_type<0>>());
+    ASSERT_TRUE(meta::resolve(hash("deferred_0")).data(hash("value")));
+    ASSERT_EQ(deferred_type<0>::registered, 1);
+    ASSERT_EQ(deferred_type<1>::registered, 0);
+
+    ASSERT_EQ(meta::resolve<deferred_type<1>>().identifier(), hash("deferred_1"));
+    ASSERT_EQ(meta::resolve(hash("deferred_1")), meta::resolve<deferred_type<1>>());
+    ASSERT_EQ(deferred_type<1>::registered, 1);
+    ASSERT_EQ(deferred_type<2>::registered, 0);
+
+    bool found = false;
+
+    meta::resolve([&found, id = hash("deferred_2")](meta::type type) {
+        found = found || (type.identifier() == id);
+    });
+
+    ASSERT_TRUE(found);
+    ASSERT_EQ(deferred_type<0>::registered, 1);
+    ASSERT_EQ(deferred_type<1>::registered, 1);
+    ASSERT_EQ(deferred_type<2>::registered, 1);
+    ASSERT_FALSE(meta::resolve(hash("deferred_3")));
+
+    ASSERT_TRUE(meta::unregister<deferred_type<0>>());
+    ASSERT_TRUE(meta::unregister<deferred_type<1>>());
+    ASSERT_TRUE(meta::unregister<deferred_type<2>>());
+}
+
+TEST_F(Meta, DeferredRegistrationRefused) {
+    std::hash<std::string_view> hash{};
+    meta::resolve<deferred_type<4>>();
+
+    ASSERT_FALSE(meta::defer<deferred_type<4>>(hash("deferred_4"), []() {
+        ++deferred_type<4>::registered;
+    }));
+
+    // pending registrations are drained without looping forever
+    meta::resolve([](meta::type) {});
+
+    ASSERT_FALSE(meta::resolve(hash("deferred_4")));
+    ASSERT_EQ(deferred_type<4>::registered, 0);
+}
+
+TEST_F(Meta, DeferredRegistrationWhileRegistering) {
+    std::hash<std::string_view> hash{};
+
+    ASSERT_TRUE(meta::defer<deferred_type<3>>(hash("deferred_3"), []() {
+        ++deferred_type<3>::registered;
+        meta::reflect<deferred_type<3>>(std::hash<std::string_view>{}("deferred_3"))
+                .data<&deferred_type<3>::value>(std::hash<std::string_view>{}("value"));
+    }));
+
+    // resolving the arguments of the meta function registers the deferred type
+    meta::reflect<deferred_user_type>(hash("deferred_user"))
+            .func<&deferred_user_type::f>(hash("f"));
+
+    ASSERT_EQ(deferred_type<3>::registered, 1);
+    ASSERT_TRUE(meta::resolve(hash("deferred_3")).data(hash("value")));
+    ASSERT_TRUE(meta::resolve(hash("deferred_user")).func(hash("f")));
+
+    deferred_user_type instance{};
+    ASSERT_EQ(meta::resolve<deferred_user_type>().func(hash("f")).invoke(instance, deferred_type<3>{42}).cast<int>(), 42);
+
+    ASSERT_TRUE(meta::unregister<deferred_user_type>());
+    ASSERT_TRUE(meta::unregister<deferred_type<3>>());
+}
+
 TEST_F(Meta, Unregister) {
     std::hash<std::string_view> hash{};
 
+    meta::any held{empty_type{}};
+
     ASSERT_FALSE(meta::unregister<float>());
     ASSERT_TRUE(meta::unregister<double>());
     ASSERT_TRUE(meta::unregister<char>());
@@ -2007,16 +2490,23 @@ TEST_F(Meta, Unregister) {
     ASSERT_TRUE(meta::unregister<unsigned int>());
     ASSERT_TRUE(meta::unregister<base_type>());
     ASSERT_TRUE(meta::unregister<derived_type>());
+    ASSERT_TRUE(meta::unregister<ctor_type>());
     ASSERT_TRUE(meta::unregister<empty_type>());
     ASSERT_TRUE(meta::unregister<fat_type>());
     ASSERT_TRUE(meta::unregister<data_type>());
     ASSERT_TRUE(meta::unregister<func_type>());
+    ASSERT_TRUE(meta::unregister<overloaded_type>());
     ASSERT_TRUE(meta::unregister<setter_getter_type>());
+    ASSERT_TRUE(meta::unregister<strict_type>());
     ASSERT_TRUE(meta::unregister<an_abstract_type>());
     ASSERT_TRUE(meta::unregister<another_abstract_type>());
     ASSERT_TRUE(meta::unregister<concrete_type>());
     ASSERT_FALSE(meta::unregister<double>());
 
+    // querying the type of a live object doesn't register it again
+    ASSERT_TRUE(held.type());
+    ASSERT_FALSE(meta::unregister<empty_type>());
+
     ASSERT_FALSE(meta::resolve(hash("char")));
     ASSERT_FALSE(meta::resolve(hash("base")));
     ASSERT_FALSE(meta::resolve(hash("derived")));
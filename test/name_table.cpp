@@ -0,0 +1,113 @@
+#include <string_view>
+#include <gtest/gtest.h>
+#include <meta/factory.hpp>
+#include <meta/hashed_string.hpp>
+#include <meta/meta.hpp>
+#include <meta/name_table.hpp>
+
+using namespace meta::literals;
+
+struct named_type {
+    int get() const { return value; }
+    int get(int offset) const { return value + offset; }
+    void set(int other) { value = other; }
+
+    int value;
+};
+
+struct unnamed_type {
+    int value;
+};
+
+TEST(NameTable, Functionalities) {
+    meta::name_table names{};
+
+    ASSERT_EQ(names.size(), 0u);
+    ASSERT_EQ(names.rejected(), 0u);
+
+    names.attach();
+
+    meta::reflect<named_type>("named_type"_hs)
+            .data<&named_type::value>("value"_hs)
+            .func<static_cast<int(named_type:: *)() const>(&named_type::get)>("get"_hs)
+            .func<static_cast<int(named_type:: *)(int) const>(&named_type::get)>("get"_hs)
+            .func<&named_type::set>("set"_hs);
+
+    meta::reflect<unnamed_type>(42).data<&unnamed_type::value>("value"_hs);
+
+    names.detach();
+
+    const auto type = meta::resolve<named_type>();
+
+    ASSERT_EQ(names.size(), 6u);
+    ASSERT_EQ(names.rejected(), 0u);
+
+    ASSERT_EQ(names.type("named_type"_hs), std::string_view{"named_type"});
+    ASSERT_EQ(names.data(type, "value"_hs), std::string_view{"value"});
+    ASSERT_EQ(names.func(type, "get"_hs), std::string_view{"get"});
+    ASSERT_EQ(names.func(type, "set"_hs), std::string_view{"set"});
+
+    ASSERT_TRUE(names.type(42).empty());
+    ASSERT_FALSE(names.data(meta::resolve<unnamed_type>(), "value"_hs).empty());
+    ASSERT_TRUE(names.data(type, "get"_hs).empty());
+    ASSERT_TRUE(names.func(type, "value"_hs).empty());
+    ASSERT_TRUE(names.data({}, "value"_hs).empty());
+
+    names.attach();
+
+    ASSERT_TRUE(meta::unregister<named_type>());
+    ASSERT_TRUE(meta::unregister<unnamed_type>());
+
+    ASSERT_EQ(names.size(), 0u);
+    ASSERT_TRUE(names.type("named_type"_hs).empty());
+    ASSERT_TRUE(names.func(type, "get"_hs).empty());
+}
+
+TEST(NameTable, Detached) {
+    meta::name_table names{};
+
+    {
+        meta::name_table other{};
+        other.attach();
+        names.attach();
+        other.detach();
+    }
+
+    meta::reflect<named_type>("named_type"_hs).data<&named_type::value>("value"_hs);
+
+    ASSERT_EQ(names.size(), 2u);
+
+    names.detach();
+    meta::unregister<named_type>();
+    ASSERT_EQ(names.size(), 2u);
+    ASSERT_EQ(names.type("named_type"_hs), std::string_view{"named_type"});
+}
+
+TEST(NameTable, Lengths) {
+    meta::name_table names{};
+    // names aren't null-terminated when they come from a larger buffer
+    const char buffer[] = "valuestring";
+
+    names.attach();
+    meta::reflect<unnamed_type>(meta::hashed_string{buffer, 5u}).data<&unnamed_type::value>(meta::hashed_string{buffer + 5u, 6u});
+    names.detach();
+
+    ASSERT_EQ(names.type("value"_hs), std::string_view{"value"});
+    ASSERT_EQ(names.data(meta::resolve<unnamed_type>(), "string"_hs), std::string_view{"string"});
+
+    meta::unregister<unnamed_type>();
+}
+
+TEST(NameTable, Overloads) {
+    meta::name_table names{};
+    names.attach();
+
+    meta::reflect<named_type>("named_type"_hs)
+            .func<static_cast<int(named_type:: *)() const>(&named_type::get)>("get"_hs)
+            .func<static_cast<int(named_type:: *)(int) const>(&named_type::get)>("get"_hs);
+
+    ASSERT_EQ(names.rejected(), 0u);
+
+    names.detach();
+    meta::unregister<named_type>();
+}
@@ -1,2 +1,11 @@
+#include <meta/binary.hpp>
+#include <meta/column.hpp>
 #include <meta/factory.hpp>
+#include <meta/hashed_string.hpp>
+#include <meta/json.hpp>
 #include <meta/meta.hpp>
+#include <meta/name_table.hpp>
+#include <meta/pool.hpp>
+#include <meta/snapshot.hpp>
+#include <meta/span.hpp>
+#include <meta/stats.hpp>
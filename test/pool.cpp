@@ -0,0 +1,160 @@
+#include <cstdint>
+#include <string_view>
+#include <gtest/gtest.h>
+#include <meta/factory.hpp>
+#include <meta/meta.hpp>
+#include <meta/pool.hpp>
+
+struct pooled_type {
+    pooled_type(int v): value{v} {
+        if(v < 0) {
+            throw v;
+        }
+
+        ++alive;
+    }
+
+    pooled_type(const pooled_type &other): value{other.value} { ++alive; }
+    ~pooled_type() { --alive; }
+
+    static void destroy(pooled_type &) {
+        ++destroyed;
+    }
+
+    inline static int alive = 0;
+    inline static int destroyed = 0;
+
+    int value;
+    char padding[13];
+};
+
+struct ObjectPool: public ::testing::Test {
+    static void SetUpTestCase() {
+        std::hash<std::string_view> hash{};
+
+        meta::reflect<pooled_type>(hash("pooled"))
+                .ctor<int>()
+                .dtor<&pooled_type::destroy>();
+    }
+
+    static void TearDownTestCase() {
+        meta::unregister<pooled_type>();
+    }
+
+    void SetUp() override {
+        pooled_type::alive = 0;
+        pooled_type::destroyed = 0;
+    }
+};
+
+TEST_F(ObjectPool, Functionalities) {
+    meta::object_pool pool{meta::resolve<pooled_type>(), 2u};
+
+    ASSERT_EQ(pool.type(), meta::resolve<pooled_type>());
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_EQ(pool.capacity(), 0u);
+
+    auto first = pool.construct(42);
+    auto second = pool.construct(3);
+
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    ASSERT_EQ(first.type(), meta::resolve<pooled_type>());
+    ASSERT_EQ(static_cast<pooled_type *>(first.data())->value, 42);
+    ASSERT_EQ(static_cast<pooled_type *>(second.data())->value, 3);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(first.data()) % alignof(pooled_type), 0u);
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.capacity(), 2u);
+    ASSERT_EQ(pooled_type::alive, 2);
+
+    ASSERT_FALSE(pool.construct('c', 'c'));
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.capacity(), 4u);
+
+    auto *data = second.data();
+    pool.destroy(second);
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(pooled_type::alive, 1);
+    ASSERT_EQ(pooled_type::destroyed, 1);
+    ASSERT_EQ(pool.construct(meta::any{7}).data(), data);
+    ASSERT_EQ(static_cast<pooled_type *>(data)->value, 7);
+    ASSERT_EQ(pool.capacity(), 4u);
+}
+
+TEST_F(ObjectPool, DestroyOnDestruction) {
+    {
+        meta::object_pool pool{meta::resolve<pooled_type>(), 4u};
+
+        for(auto i = 0; i < 6; ++i) {
+            pool.construct(i);
+        }
+
+        pool.destroy(pool.construct(42));
+
+        ASSERT_EQ(pooled_type::alive, 6);
+        ASSERT_EQ(pooled_type::destroyed, 1);
+    }
+
+    ASSERT_EQ(pooled_type::alive, 0);
+    ASSERT_EQ(pooled_type::destroyed, 7);
+}
+
+TEST_F(ObjectPool, DestroyScatteredOnDestruction) {
+    {
+        meta::object_pool pool{meta::resolve<pooled_type>(), 3u};
+        meta::handle handles[10u];
+
+        for(auto i = 0; i < 10; ++i) {
+            handles[i] = pool.construct(i);
+        }
+
+        for(auto i = 0; i < 10; i += 3) {
+            pool.destroy(handles[i]);
+        }
+
+        ASSERT_EQ(pool.size(), 6u);
+        ASSERT_EQ(pool.capacity(), 12u);
+        ASSERT_EQ(pooled_type::alive, 6);
+        ASSERT_EQ(pooled_type::destroyed, 4);
+    }
+
+    ASSERT_EQ(pooled_type::alive, 0);
+    ASSERT_EQ(pooled_type::destroyed, 10);
+}
+
+TEST_F(ObjectPool, Move) {
+    meta::object_pool pool{meta::resolve<pooled_type>()};
+    auto handle = pool.construct(42);
+    meta::object_pool other{std::move(pool)};
+
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_EQ(static_cast<pooled_type *>(handle.data())->value, 42);
+
+    pool = std::move(other);
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(other.size(), 0u);
+
+    pool.destroy(handle);
+
+    ASSERT_EQ(pooled_type::alive, 0);
+}
+
+TEST_F(ObjectPool, ThrowingConstructor) {
+    meta::object_pool pool{meta::resolve<pooled_type>(), 1u};
+
+    ASSERT_THROW(pool.construct(-1), int);
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_EQ(pool.capacity(), 1u);
+
+    // the slot went back to the pool, no need to grow
+    auto handle = pool.construct(42);
+
+    ASSERT_TRUE(handle);
+    ASSERT_EQ(pool.capacity(), 1u);
+
+    pool.destroy(handle);
+
+    ASSERT_EQ(pooled_type::alive, 0);
+}
@@ -0,0 +1,146 @@
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <gtest/gtest.h>
+#include <meta/factory.hpp>
+#include <meta/meta.hpp>
+#include <meta/snapshot.hpp>
+
+struct snapshot_base {
+    int base;
+};
+
+struct snapshot_type: snapshot_base {
+    int f(int v) const { return v; }
+    int f(int v, int) const { return v; }
+    static void g() {}
+
+    int value;
+    const int constant{};
+    inline static char counter = 0;
+};
+
+struct Snapshot: public ::testing::Test {
+    static void SetUpTestCase() {
+        std::hash<std::string_view> hash{};
+
+        meta::reflect<snapshot_base>(hash("snapshot_base"))
+                .data<&snapshot_base::base>(hash("base"));
+
+        meta::reflect<snapshot_type>(hash("snapshot"), std::make_pair(hash("key"), 42))
+                .base<snapshot_base>()
+                .data<&snapshot_type::value>(hash("value"), std::make_pair(hash("key"), 0))
+                .data<&snapshot_type::constant>(hash("constant"))
+                .data<&snapshot_type::counter>(hash("counter"))
+                .func<static_cast<int(snapshot_type:: *)(int) const>(&snapshot_type::f)>(hash("f"))
+                .func<static_cast<int(snapshot_type:: *)(int, int) const>(&snapshot_type::f)>(hash("f"))
+                .func<&snapshot_type::g>(hash("g"));
+    }
+
+    static void TearDownTestCase() {
+        meta::unregister<snapshot_base>();
+        meta::unregister<snapshot_type>();
+    }
+};
+
+TEST_F(Snapshot, Functionalities) {
+    std::hash<std::string_view> hash{};
+    const auto buffer = meta::snapshot();
+    const meta::snapshot_view view{buffer.data(), buffer.size()};
+
+    ASSERT_TRUE(view);
+    ASSERT_NE(view.size(), 0u);
+
+    for(std::size_t pos = 1u; pos < view.size(); ++pos) {
+        ASSERT_LT(view[pos - 1u].identifier, view[pos].identifier);
+    }
+
+    ASSERT_FALSE(view.find(hash("unknown")));
+
+    const auto type = view.find(hash("snapshot"));
+
+    ASSERT_TRUE(type);
+    ASSERT_EQ(type.identifier, hash("snapshot"));
+    ASSERT_EQ(type.size_of, sizeof(snapshot_type));
+    ASSERT_EQ(type.align_of, alignof(snapshot_type));
+    ASSERT_EQ(type.traits, meta::resolve<snapshot_type>().traits());
+    ASSERT_EQ(type.traits & meta::type_traits::is_class, meta::type_traits::is_class);
+    ASSERT_EQ(type.traits & meta::type_traits::is_pointer, meta::type_traits::none);
+    ASSERT_EQ(type.props, 1u);
+    ASSERT_EQ(view.prop(type, 0u).type, meta::resolve<std::size_t>().identifier());
+    ASSERT_EQ(view.prop(type, 0u).value, hash("key"));
+    ASSERT_EQ(view.prop(type, 0u).traits & meta::type_traits::is_integral, meta::type_traits::is_integral);
+    ASSERT_EQ(type.bases, 1u);
+    ASSERT_EQ(type.data, 4u);
+    ASSERT_EQ(type.func, 3u);
+
+    const auto value = view.find_data(type, hash("value"));
+
+    ASSERT_TRUE(value);
+    ASSERT_EQ(value.type, meta::resolve<int>().identifier());
+    ASSERT_FALSE(value.is_const);
+    ASSERT_FALSE(value.is_static);
+    // derived classes with members aren't standard layout
+    ASSERT_EQ(value.offset, meta::snapshot_member::npos);
+    ASSERT_EQ(view.find_data(view.find(hash("snapshot_base")), hash("base")).offset, 0u);
+    ASSERT_EQ(value.props, 1u);
+    ASSERT_EQ(view.prop(value, 0u).value, hash("key"));
+    ASSERT_TRUE(view.find_data(type, hash("constant")).is_const);
+    ASSERT_TRUE(view.find_data(type, hash("counter")).is_static);
+    ASSERT_EQ(view.find_data(type, hash("counter")).offset, meta::snapshot_member::npos);
+    ASSERT_TRUE(view.find_data(type, hash("base")));
+    ASSERT_FALSE(view.find_data(type, hash("f")));
+
+    const auto func = view.find_func(type, hash("f"));
+
+    ASSERT_TRUE(func);
+    ASSERT_TRUE(func.is_const);
+    ASSERT_EQ(func.offset, meta::snapshot_member::npos);
+    ASSERT_TRUE(view.find_func(type, hash("g")).is_static);
+    ASSERT_EQ(view.find_func(type, hash("g")).arity, 0u);
+
+    std::uint32_t overloads{};
+
+    for(std::size_t pos{}; pos < type.func; ++pos) {
+        overloads += (view.func(type, pos).identifier == hash("f"));
+    }
+
+    ASSERT_EQ(overloads, 2u);
+    ASSERT_EQ(view.resolve(hash("snapshot")), meta::resolve<snapshot_type>());
+    ASSERT_FALSE(view.resolve(hash("unknown")));
+}
+
+TEST_F(Snapshot, Invalid) {
+    auto buffer = meta::snapshot();
+
+    ASSERT_FALSE((meta::snapshot_view{nullptr, 0u}));
+    ASSERT_FALSE((meta::snapshot_view{buffer.data(), buffer.size() - 1u}));
+    ASSERT_EQ((meta::snapshot_view{buffer.data(), buffer.size() - 1u}).size(), 0u);
+
+    buffer[0u] = std::byte{};
+
+    ASSERT_FALSE((meta::snapshot_view{buffer.data(), buffer.size()}));
+}
+
+TEST_F(Snapshot, Corrupted) {
+    std::hash<std::string_view> hash{};
+    const auto buffer = meta::snapshot();
+    const meta::snapshot_view view{buffer.data(), buffer.size()};
+    auto type = view.find(hash("snapshot"));
+
+    ASSERT_TRUE(view.find_data(type, hash("value")));
+    ASSERT_TRUE(view.find_func(type, hash("f")));
+
+    type.first = std::numeric_limits<std::uint32_t>::max();
+
+    ASSERT_FALSE(view.find_data(type, hash("value")));
+    ASSERT_FALSE(view.find_func(type, hash("f")));
+    ASSERT_FALSE(view.data(type, 0u));
+    ASSERT_FALSE(view.func(type, 0u));
+
+    type.first_prop = std::numeric_limits<std::uint32_t>::max();
+
+    ASSERT_EQ(view.prop(type, 0u).type, 0u);
+}
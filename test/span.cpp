@@ -0,0 +1,134 @@
+#include <string_view>
+#include <gtest/gtest.h>
+#include <meta/column.hpp>
+#include <meta/factory.hpp>
+#include <meta/meta.hpp>
+#include <meta/span.hpp>
+
+struct span_type {
+    int get() const { return value; }
+    void set(int other) { value = other; }
+
+    int value;
+    char padding[12];
+};
+
+struct Span: public ::testing::Test {
+    static void SetUpTestCase() {
+        std::hash<std::string_view> hash{};
+
+        meta::reflect<span_type>(hash("span"))
+                .data<&span_type::value>(hash("value"))
+                .data<&span_type::set, &span_type::get>(hash("accessor"));
+    }
+
+    static void TearDownTestCase() {
+        meta::unregister<span_type>();
+    }
+};
+
+TEST_F(Span, Functionalities) {
+    int array[4]{0, 1, 2, 3};
+    meta::any_span span{meta::resolve<int>(), array, 4u};
+
+    ASSERT_EQ(span.type(), meta::resolve<int>());
+    ASSERT_EQ(span.size(), 4u);
+    ASSERT_EQ(span.stride(), sizeof(int));
+    ASSERT_EQ(span.data(), array);
+    ASSERT_FALSE(span.empty());
+    ASSERT_TRUE(meta::any_span{}.empty());
+
+    int expected = 0;
+
+    for(auto elem: span) {
+        ASSERT_EQ(elem.type(), meta::resolve<int>());
+        ASSERT_EQ(elem.data(), &array[expected]);
+        ++*static_cast<int *>(elem.data());
+        ++expected;
+    }
+
+    ASSERT_EQ(expected, 4);
+    ASSERT_EQ(array[0], 1);
+    ASSERT_EQ(array[3], 4);
+
+    const auto sub = span.subspan(1u, 2u);
+
+    ASSERT_EQ(sub.size(), 2u);
+    ASSERT_EQ(sub[0u].data(), &array[1]);
+    ASSERT_EQ(sub[1u].data(), &array[2]);
+    ASSERT_TRUE(span.subspan(4u, 0u).empty());
+}
+
+TEST_F(Span, Stride) {
+    span_type instances[3]{{0, {}}, {1, {}}, {2, {}}};
+    meta::any_span span{meta::resolve<span_type>(), instances, 3u};
+    meta::any_span values{meta::resolve<int>(), &instances[0].value, 3u, sizeof(span_type)};
+
+    ASSERT_EQ(span.stride(), sizeof(span_type));
+    ASSERT_EQ(values.stride(), sizeof(span_type));
+
+    const auto data = meta::resolve<span_type>().data(std::hash<std::string_view>{}("value"));
+
+    for(std::size_t pos{}; pos < span.size(); ++pos) {
+        ASSERT_TRUE(data.set(span[pos], 42 + int(pos)));
+        ASSERT_EQ(values[pos].data(), &instances[pos].value);
+        ASSERT_EQ(*static_cast<int *>(values[pos].data()), 42 + int(pos));
+    }
+}
+
+TEST_F(Span, Column) {
+    meta::column column{meta::resolve<int>()};
+
+    ASSERT_TRUE(column.span().empty());
+
+    for(int value = 0; value < 3; ++value) {
+        column.push_back(value);
+    }
+
+    const auto span = column.span();
+
+    ASSERT_EQ(span.type(), column.type());
+    ASSERT_EQ(span.size(), column.size());
+    ASSERT_EQ(span.data(), column.data());
+
+    for(std::size_t pos{}; pos < span.size(); ++pos) {
+        ASSERT_EQ(span[pos].data(), column[pos].data());
+    }
+}
+
+TEST_F(Span, GatherScatter) {
+    std::hash<std::string_view> hash{};
+    span_type instances[3]{{0, {}}, {1, {}}, {2, {}}};
+    meta::any_span span{meta::resolve<span_type>(), instances, 3u};
+    const auto type = meta::resolve<span_type>();
+    int values[3]{};
+
+    ASSERT_NE(type.data(hash("value")).offset(), meta::data::npos);
+    ASSERT_TRUE(meta::gather(type.data(hash("value")), span, values));
+    ASSERT_EQ(values[0], 0);
+    ASSERT_EQ(values[2], 2);
+
+    const int others[3]{42, 43, 44};
+
+    ASSERT_TRUE(meta::scatter(type.data(hash("value")), span.subspan(1u, 2u), others));
+    ASSERT_EQ(instances[0].value, 0);
+    ASSERT_EQ(instances[1].value, 42);
+    ASSERT_EQ(instances[2].value, 43);
+
+    ASSERT_EQ(type.data(hash("accessor")).offset(), meta::data::npos);
+    ASSERT_TRUE(meta::scatter(type.data(hash("accessor")), span, others));
+    ASSERT_TRUE(meta::gather(type.data(hash("accessor")), span, values));
+    ASSERT_EQ(values[0], 42);
+    ASSERT_EQ(values[1], 43);
+    ASSERT_EQ(values[2], 44);
+
+    meta::any_span ints{meta::resolve<int>(), values, 3u};
+
+    ASSERT_FALSE(meta::gather(type.data(hash("value")), ints, values));
+    ASSERT_TRUE(meta::gather(type.data(hash("value")), meta::any_span{}, values));
+    ASSERT_TRUE(meta::scatter(type.data(hash("value")), meta::any_span{}, values));
+    ASSERT_TRUE(meta::gather(type.data(hash("value")), span.subspan(0u, 0u), values));
+    ASSERT_FALSE(meta::gather(meta::data{}, span, values));
+    ASSERT_FALSE(meta::scatter(meta::data{}, span, values));
+    ASSERT_FALSE(meta::gather(meta::data{}, meta::any_span{}, values));
+}
@@ -0,0 +1,73 @@
+#include <cstddef>
+#include <utility>
+#include <gtest/gtest.h>
+#include <meta/factory.hpp>
+#include <meta/meta.hpp>
+#include <meta/stats.hpp>
+
+enum class stats_property {
+    key
+};
+
+struct stats_base {
+    int base;
+};
+
+struct stats_type: stats_base {
+    template<std::size_t Value>
+    std::size_t get() const { return Value; }
+
+    int value;
+};
+
+struct stats_derived: stats_type {
+    int other() const { return value; }
+};
+
+template<std::size_t... Index>
+void reflect_stats_type(std::index_sequence<Index...>) {
+    auto factory = meta::reflect<stats_type>(2u, std::make_pair(stats_property::key, 0))
+            .base<stats_base>()
+            .conv<stats_base>()
+            .ctor<>()
+            .data<&stats_type::value>(1u, std::make_pair(stats_property::key, 1));
+
+    (factory.func<&stats_type::get<Index>>(Index + 1u), ...);
+}
+
+TEST(Stats, Functionalities) {
+    const auto before = meta::stats();
+
+    meta::reflect<stats_base>(1u).data<&stats_base::base>(1u);
+    reflect_stats_type(std::make_index_sequence<32u>{});
+    meta::reflect<stats_derived>(3u).base<stats_type>().func<&stats_derived::other>(42u);
+
+    const auto after = meta::stats();
+
+    ASSERT_EQ(after.types - before.types, 3u);
+    ASSERT_EQ(after.data - before.data, 2u);
+    ASSERT_EQ(after.funcs - before.funcs, 33u);
+    ASSERT_EQ(after.ctors - before.ctors, 1u);
+    ASSERT_EQ(after.convs - before.convs, 1u);
+    ASSERT_EQ(after.bases - before.bases, 2u);
+    ASSERT_EQ(after.props - before.props, 2u);
+    ASSERT_GT(after.bytes, before.bytes);
+
+    ASSERT_GE(after.func_chain.max, 33u);
+    ASSERT_EQ(after.func_chain.longest, meta::resolve<stats_derived>());
+    ASSERT_GE(after.data_chain.max, 2u);
+    ASSERT_GE(after.prop_chain.max, 1u);
+    ASSERT_GT(after.func_chain.average, 0.);
+    ASSERT_GE(after.base_depth, 2u);
+
+    meta::unregister<stats_derived>();
+    meta::unregister<stats_type>();
+    meta::unregister<stats_base>();
+
+    const auto restored = meta::stats();
+
+    ASSERT_EQ(restored.types, before.types);
+    ASSERT_EQ(restored.funcs, before.funcs);
+    ASSERT_EQ(restored.props, before.props);
+    ASSERT_EQ(restored.bytes, before.bytes);
+}
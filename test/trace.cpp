@@ -0,0 +1,165 @@
+#include <vector>
+#include <gtest/gtest.h>
+#include <meta/factory.hpp>
+#include <meta/meta.hpp>
+
+struct traced_type {
+    traced_type() = default;
+    traced_type(int other): value{other} {}
+
+    int sum(int other) const { return value + other; }
+
+    int value{};
+};
+
+std::vector<meta::trace_record> records{};
+
+void record(const meta::trace_record &record) {
+    records.push_back(record);
+}
+
+std::vector<meta::trace_record> filter(const meta::trace_event event) {
+    std::vector<meta::trace_record> ret{};
+
+    for(auto &&curr: records) {
+        if(curr.event == event) {
+            ret.push_back(curr);
+        }
+    }
+
+    return ret;
+}
+
+struct Trace: public ::testing::Test {
+    static void SetUpTestCase() {
+        meta::reflect<int>()
+                .conv<double>();
+
+        meta::reflect<traced_type>(1u)
+                .ctor<int>()
+                .data<&traced_type::value>(2u)
+                .func<&traced_type::sum>(3u);
+    }
+
+    static void TearDownTestCase() {
+        meta::unregister<traced_type>();
+        meta::unregister<int>();
+    }
+
+    void SetUp() override {
+        records.clear();
+        ASSERT_EQ(meta::trace(&record), nullptr);
+    }
+
+    void TearDown() override {
+        ASSERT_EQ(meta::trace(nullptr), &record);
+    }
+};
+
+TEST_F(Trace, Invoke) {
+    const auto type = meta::resolve<traced_type>();
+    traced_type instance{1};
+
+    ASSERT_EQ(type.func(3u).invoke(instance, 2).cast<int>(), 3);
+    ASSERT_EQ(type.invoke(3u, instance, 2).cast<int>(), 3);
+    ASSERT_FALSE(type.func(3u).invoke(instance, 'c'));
+
+    const auto invoke = filter(meta::trace_event::invoke);
+
+    ASSERT_EQ(invoke.size(), 3u);
+
+    for(auto &&curr: invoke) {
+        ASSERT_EQ(curr.type, type);
+        ASSERT_EQ(curr.identifier, 3u);
+        ASSERT_NE(curr.node, nullptr);
+        ASSERT_GE(curr.duration.count(), 0);
+    }
+
+    ASSERT_EQ(invoke[0u].node, invoke[1u].node);
+    ASSERT_TRUE(invoke[0u].success);
+    ASSERT_TRUE(invoke[1u].success);
+    ASSERT_FALSE(invoke[2u].success);
+
+    // the failed invocation tried to cast and convert its argument first
+    ASSERT_FALSE(filter(meta::trace_event::cast).empty());
+    ASSERT_FALSE(filter(meta::trace_event::convert).empty());
+}
+
+TEST_F(Trace, Data) {
+    const auto data = meta::resolve<traced_type>().data(2u);
+    traced_type instance{};
+
+    ASSERT_TRUE(data.set(instance, 42));
+    ASSERT_FALSE(data.set(instance, 'c'));
+    ASSERT_EQ(data.get(instance).cast<int>(), 42);
+
+    const auto set = filter(meta::trace_event::set);
+    const auto get = filter(meta::trace_event::get);
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_TRUE(set[0u].success);
+    ASSERT_FALSE(set[1u].success);
+    ASSERT_EQ(get.size(), 1u);
+    ASSERT_TRUE(get[0u].success);
+    ASSERT_EQ(get[0u].type, meta::resolve<traced_type>());
+    ASSERT_EQ(get[0u].identifier, 2u);
+}
+
+TEST_F(Trace, Construct) {
+    const auto type = meta::resolve<traced_type>();
+
+    ASSERT_TRUE(type.construct(42));
+    ASSERT_FALSE(type.construct('c', 'c'));
+
+    const auto construct = filter(meta::trace_event::construct);
+
+    ASSERT_EQ(construct.size(), 2u);
+    ASSERT_EQ(construct[0u].type, type);
+    ASSERT_TRUE(construct[0u].success);
+    ASSERT_FALSE(construct[1u].success);
+
+    records.clear();
+
+    traced_type instance{};
+    const auto ctor = type.ctor<int>();
+
+    ASSERT_TRUE(ctor.invoke(42));
+    ASSERT_TRUE(ctor.construct_at(&instance, 3));
+    ASSERT_TRUE(type.construct_at(&instance, 4));
+    ASSERT_FALSE(type.construct_at(&instance, 'c', 'c'));
+    ASSERT_EQ(instance.value, 4);
+
+    const auto in_place = filter(meta::trace_event::construct);
+
+    ASSERT_EQ(in_place.size(), 4u);
+    ASSERT_EQ(in_place[0u].node, in_place[1u].node);
+    ASSERT_NE(in_place[1u].node, in_place[2u].node);
+
+    for(auto &&curr: in_place) {
+        ASSERT_EQ(curr.type, type);
+        ASSERT_EQ(curr.identifier, 1u);
+    }
+
+    ASSERT_TRUE(in_place[2u].success);
+    ASSERT_FALSE(in_place[3u].success);
+}
+
+TEST_F(Trace, ConvertAndCast) {
+    meta::any any{42};
+
+    ASSERT_NE(any.try_cast<int>(), nullptr);
+    ASSERT_TRUE(records.empty());
+
+    ASSERT_EQ(any.try_cast<char>(), nullptr);
+    ASSERT_TRUE(any.convert<double>());
+
+    ASSERT_EQ(records.size(), 2u);
+    ASSERT_EQ(records[0u].event, meta::trace_event::cast);
+    ASSERT_EQ(records[0u].type, meta::resolve<char>());
+    ASSERT_EQ(records[0u].node, records[1u].node);
+    ASSERT_FALSE(records[0u].success);
+    ASSERT_EQ(records[0u].duration.count(), 0);
+    ASSERT_EQ(records[1u].event, meta::trace_event::convert);
+    ASSERT_EQ(records[1u].type, meta::resolve<double>());
+    ASSERT_TRUE(records[1u].success);
+}